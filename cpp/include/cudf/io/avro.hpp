@@ -54,6 +54,11 @@ class avro_reader_options {
   // Rows to read; -1 is all
   size_type _num_rows = -1;
 
+  // Bytes to skip from the start; only the blocks that start within the byte range are read
+  size_t _byte_range_offset = 0;
+  // Bytes to read; 0 is the rest of the source
+  size_t _byte_range_size = 0;
+
   /**
    * @brief Constructor from source info.
    *
@@ -91,6 +96,16 @@ class avro_reader_options {
    */
   size_type get_num_rows() const { return _num_rows; }
 
+  /**
+   * @brief Returns number of bytes to skip from source start.
+   */
+  size_t get_byte_range_offset() const { return _byte_range_offset; }
+
+  /**
+   * @brief Returns number of bytes to read.
+   */
+  size_t get_byte_range_size() const { return _byte_range_size; }
+
   /**
    * @brief Set names of the column to be read.
    *
@@ -114,6 +129,24 @@ class avro_reader_options {
    */
   void set_num_rows(size_type val) { _num_rows = val; }
 
+  /**
+   * @brief Sets number of bytes to skip from source start.
+   *
+   * Only the blocks that start within the byte range are read, so that consecutive byte ranges
+   * read each row of the source exactly once. The rows to skip and to read are relative to the
+   * first row of the byte range.
+   *
+   * @param offset Number of bytes of offset.
+   */
+  void set_byte_range_offset(size_t offset) { _byte_range_offset = offset; }
+
+  /**
+   * @brief Sets number of bytes to read.
+   *
+   * @param size Number of bytes to read; 0 reads up to the end of the source.
+   */
+  void set_byte_range_size(size_t size) { _byte_range_size = size; }
+
   /**
    * @brief create avro_reader_options_builder which will build avro_reader_options.
    *
@@ -177,6 +210,30 @@ class avro_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets number of bytes to skip from source start.
+   *
+   * @param offset Number of bytes of offset.
+   * @return this for chaining.
+   */
+  avro_reader_options_builder& byte_range_offset(size_t offset)
+  {
+    options._byte_range_offset = offset;
+    return *this;
+  }
+
+  /**
+   * @brief Sets number of bytes to read.
+   *
+   * @param size Number of bytes to read.
+   * @return this for chaining.
+   */
+  avro_reader_options_builder& byte_range_size(size_t size)
+  {
+    options._byte_range_size = size;
+    return *this;
+  }
+
   /**
    * @brief move avro_reader_options member once it's built.
    */
@@ -213,6 +270,64 @@ table_with_metadata read_avro(
   avro_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Forward declaration of anonymous chunked-reader state struct.
+ */
+struct avro_chunked_state;
+
+/**
+ * @brief Begin the process of reading an Avro dataset in chunks of rows.
+ *
+ * The intent of the read_avro_chunked_ path is to allow reading datasets that are too large to be
+ * held in memory at once. Only the file header is read up front; each chunk reads and decodes only
+ * the blocks that contain its rows.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of one million rows.
+ * @code
+ *  ...
+ *  std::string filepath = "dataset.avro";
+ *  cudf::io::avro_reader_options options =
+ * cudf::io::avro_reader_options::builder(cudf::source_info(filepath));
+ *  ...
+ *  auto state = cudf::io::read_avro_chunked_begin(options, 1000000);
+ *  while (cudf::io::read_avro_chunked_has_next(state)) {
+ *    auto chunk = cudf::io::read_avro_chunked(state);
+ *    ...
+ *  }
+ * @endcode
+ *
+ * @param options Settings for controlling reading behavior; the rows to skip and to read apply to
+ * the chunks as a whole
+ * @param chunk_rows Maximum number of rows of each chunk
+ * @param mr Device memory resource used to allocate device memory of the returned tables
+ *
+ * @returns pointer to an anonymous state structure storing information about the chunked read.
+ * this pointer must be passed to all subsequent read_avro_chunked_has_next() and
+ * read_avro_chunked() calls.
+ */
+std::shared_ptr<avro_chunked_state> read_avro_chunked_begin(
+  avro_reader_options const& options,
+  size_type chunk_rows,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns true if a chunked read has rows left to read.
+ *
+ * @param[in] state Opaque state information about the read process. Must be the same pointer
+ * returned from read_avro_chunked_begin()
+ */
+bool read_avro_chunked_has_next(std::shared_ptr<avro_chunked_state> const& state);
+
+/**
+ * @brief Reads the next chunk of rows of a chunked read.
+ *
+ * @param[in] state Opaque state information about the read process. Must be the same pointer
+ * returned from read_avro_chunked_begin()
+ *
+ * @return The set of columns of at most `chunk_rows` rows along with metadata
+ */
+table_with_metadata read_avro_chunked(std::shared_ptr<avro_chunked_state> const& state);
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
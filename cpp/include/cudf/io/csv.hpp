@@ -24,6 +24,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -1093,6 +1094,60 @@ table_with_metadata read_csv(
   csv_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Splits a CSV dataset into byte ranges of balanced size that can be read independently.
+ *
+ * Each range is returned as an (offset, size) pair to be passed to `byte_range_offset` and
+ * `byte_range_size`; together, the ranges cover every row of the dataset exactly once. Range
+ * boundaries are placed at line terminators, assuming that the terminators are not quoted. The
+ * header row is read from the start of the dataset when reading any of the ranges.
+ *
+ * The following code snippet demonstrates how to read a dataset in four parts:
+ * @code
+ *  auto options = cudf::io::csv_reader_options::builder(cudf::source_info(filepath)).build();
+ *  for (auto const& range : cudf::io::plan_csv_byte_ranges(options, 4)) {
+ *    options.set_byte_range_offset(range.first);
+ *    options.set_byte_range_size(range.second);
+ *    auto result = cudf::io::read_csv(options);
+ *    ...
+ *  }
+ * @endcode
+ *
+ * @param options Settings for reading the dataset; only the source and the line terminator are
+ * used. The dataset must not be compressed
+ * @param num_ranges Maximum number of ranges; fewer are returned for small datasets
+ *
+ * @return (offset, size) pairs of the byte ranges, in order
+ */
+std::vector<std::pair<size_t, size_t>> plan_csv_byte_ranges(csv_reader_options const& options,
+                                                            size_t num_ranges);
+
+/**
+ * @brief Infers the column types of a CSV dataset from a sample of its rows.
+ *
+ * Only the sampled rows are parsed. The returned schema can be cached, and passed to the `dtypes`
+ * option to read this or any other dataset of the same shape without type inference.
+ *
+ * The following code snippet demonstrates how to read a dataset with the inferred types:
+ * @code
+ *  auto options = cudf::io::csv_reader_options::builder(cudf::source_info(filepath)).build();
+ *  auto schema  = cudf::io::infer_csv_schema(options);
+ *  options.set_dtypes(schema.dtypes);
+ *  auto result  = cudf::io::read_csv(options);
+ * @endcode
+ *
+ * @param options Settings for reading the dataset; the byte range is ignored
+ * @param sampling Number and size of the samples. Samples start and end at line terminators,
+ * assuming that the terminators are not quoted
+ * @param mr Device memory resource used to allocate device memory while reading the sample
+ *
+ * @return Column names and types of the dataset
+ */
+table_schema infer_csv_schema(
+  csv_reader_options const& options,
+  schema_sampling_options const& sampling = {},
+  rmm::mr::device_memory_resource* mr     = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
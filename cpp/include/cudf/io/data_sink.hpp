@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/io/types.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -28,6 +29,67 @@
 namespace cudf {
 //! IO interfaces
 namespace io {
+/**
+ * @brief Host memory output buffer made of a chain of fixed-size chunks.
+ *
+ * Unlike a `std::vector`, appending data never reallocates or copies the data accumulated so far.
+ * The content can be accessed as a list of the chunks (e.g. to send it with scatter/gather IO),
+ * or flattened into a single contiguous buffer once writing is done.
+ */
+class chunked_host_buffer {
+ public:
+  static constexpr size_t default_chunk_size = 4 * 1024 * 1024;
+
+  /**
+   * @brief Constructs an empty buffer.
+   *
+   * @param[in] chunk_size Size of each allocated chunk, in bytes
+   */
+  explicit chunked_host_buffer(size_t chunk_size = default_chunk_size);
+
+  /**
+   * @brief Appends data at the end of the buffer
+   *
+   * @param[in] data Pointer to the data to append
+   * @param[in] size Number of bytes to append
+   */
+  void append(void const* data, size_t size);
+
+  /**
+   * @brief Allocates chunks up front for a total of at least `size` bytes
+   *
+   * @param[in] size Expected total size of the buffer, in bytes
+   */
+  void reserve(size_t size);
+
+  /**
+   * @brief Returns the number of bytes in the buffer
+   */
+  size_t size() const { return size_; }
+
+  /**
+   * @brief Returns views of the filled part of each chunk, in order
+   *
+   * The views are valid until the buffer is cleared or destroyed.
+   */
+  std::vector<host_buffer> chunks() const;
+
+  /**
+   * @brief Returns the content of the buffer as a single contiguous vector
+   */
+  std::vector<char> flatten() const;
+
+  /**
+   * @brief Releases all chunks
+   */
+  void clear();
+
+ private:
+  size_t chunk_size_;
+  size_t size_ = 0;
+  std::vector<std::unique_ptr<char[]>> chunks_;
+};
+
 /**
  * @brief Interface class for storing the output data from the writers
  */
@@ -36,9 +98,13 @@ class data_sink {
   /**
    * @brief Create a sink from a file path
    *
+   * Writes are accumulated in large buffers that are written to the file in the background.
+   *
    * @param[in] filepath Path to the file to use
+   * @param[in] sync_policy When to synchronize the written data to the storage device
    */
-  static std::unique_ptr<data_sink> create(const std::string& filepath);
+  static std::unique_ptr<data_sink> create(
+    const std::string& filepath, file_sync_policy sync_policy = file_sync_policy::NONE);
 
   /**
    * @brief Create a sink from a std::vector
@@ -47,6 +113,13 @@ class data_sink {
    */
   static std::unique_ptr<data_sink> create(std::vector<char>* buffer);
 
+  /**
+   * @brief Create a sink from a chunked host buffer
+   *
+   * @param[in,out] buffer Pointer to the output buffer
+   */
+  static std::unique_ptr<data_sink> create(chunked_host_buffer* buffer);
+
   /**
    * @brief Create a void sink (one that does no actual io)
    *
@@ -120,6 +193,21 @@ class data_sink {
     CUDF_FAIL("data_sink classes that support device_write must override this function.");
   }
 
+  /**
+   * @brief Hints the total number of bytes that are expected to be written into the sink
+   *
+   * Sinks that hold the output in memory can use the hint to allocate storage up front. The hint
+   * does not need to be exact, and can be given multiple times as the estimate is refined.
+   *
+   * Data sink implementations that don't preallocate storage don't need to override this
+   * function; the default implementation ignores the hint.
+   *
+   * @param[in] size Expected total number of bytes, including the bytes already written
+   *
+   * @return void
+   */
+  virtual void set_expected_size(size_t size) {}
+
   /**
    * @brief Flush the data written into the sink
    *
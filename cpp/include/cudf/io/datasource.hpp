@@ -25,6 +25,8 @@
 #include <arrow/io/memory.h>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 //! IO interfaces
@@ -61,13 +63,38 @@ class datasource {
   /**
    * @brief Creates a source from a file path.
    *
+   * The `offset` and `size` limit the region that memory mapped sources map and read; sources that
+   * read with `pread()` can access the entire file.
+   *
    * @param[in] filepath Path to the file to use
    * @param[in] offset Bytes from the start of the file (the default is zero)
    * @param[in] size Bytes from the offset; use zero for entire file (the default is zero)
+   * @param[in] mode Method used to read the file (the default is `file_read_mode::AUTO`)
    */
   static std::unique_ptr<datasource> create(const std::string& filepath,
-                                            size_t offset = 0,
-                                            size_t size   = 0);
+                                            size_t offset       = 0,
+                                            size_t size         = 0,
+                                            file_read_mode mode = file_read_mode::AUTO);
+
+  /**
+   * @brief Creates a source for each file path.
+   *
+   * @param[in] filepaths Paths to the files to use
+   * @param[in] mode Method used to read the files
+   */
+  static std::vector<std::unique_ptr<datasource>> create(std::vector<std::string> const& filepaths,
+                                                         file_read_mode mode)
+  {
+    std::vector<std::unique_ptr<datasource>> sources;
+    sources.reserve(filepaths.size());
+    std::transform(filepaths.cbegin(),
+                   filepaths.cend(),
+                   std::back_inserter(sources),
+                   [mode](auto const& filepath) {
+                     return datasource::create(filepath, 0, 0, mode);
+                   });
+    return sources;
+  }
 
   /**
    * @brief Creates a source from a memory buffer.
@@ -133,6 +160,21 @@ class datasource {
    */
   virtual size_t host_read(size_t offset, size_t size, uint8_t* dst) = 0;
 
+  /**
+   * @brief Hints that the given ranges are going to be read in the near future.
+   *
+   * Sources that can service reads asynchronously may start fetching the ranges in the
+   * background; later `host_read()` calls that fall within a hinted range are then served from the
+   * fetched data. Readers call this with the ranges they are about to read, in the order they are
+   * going to read them.
+   *
+   * Data source implementations that don't support prefetching don't need to override this
+   * function; the default implementation ignores the hint.
+   *
+   * @param[in] ranges List of (offset, size) pairs of the upcoming reads
+   */
+  virtual void prefetch(std::vector<std::pair<size_t, size_t>> const& ranges) {}
+
   /**
    * @brief Whether or not this source supports reading directly into device memory.
    *
@@ -147,6 +189,16 @@ class datasource {
    */
   virtual bool supports_device_read() const { return false; }
 
+  /**
+   * @brief Whether or not `host_read()` returns views of the source data without copying it.
+   *
+   * Readers do not read ahead of time from such sources into intermediate buffers, as this would
+   * add a copy of the data.
+   *
+   * @return bool Whether `host_read()` calls avoid copying the data
+   */
+  virtual bool supports_zero_copy_host_read() const { return false; }
+
   /**
    * @brief Returns a device buffer with a subset of data from the source.
    *
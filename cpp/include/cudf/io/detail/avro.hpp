@@ -75,6 +75,24 @@ class reader {
    */
   table_with_metadata read(avro_reader_options const &options,
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns true if there are rows left to read with `read_chunk()`.
+   */
+  bool has_next();
+
+  /**
+   * @brief Reads the next chunk of the rows selected by the options the reader was created with.
+   *
+   * Only the blocks that contain the rows of the chunk are read from the source.
+   *
+   * @param chunk_rows Maximum number of rows to read
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(size_type chunk_rows,
+                                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 }  // namespace avro
 }  // namespace detail
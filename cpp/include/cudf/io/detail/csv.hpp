@@ -68,6 +68,17 @@ class reader {
    * @return The set of columns along with table metadata
    */
   table_with_metadata read(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Infers the schema of the dataset from a sample of its rows.
+   *
+   * @param sampling Number and size of the samples
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The inferred schema
+   */
+  table_schema infer_schema(schema_sampling_options const &sampling,
+                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
 class writer {
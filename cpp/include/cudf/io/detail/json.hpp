@@ -81,6 +81,19 @@ class reader {
    */
   table_with_metadata read(json_reader_options const &options,
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Infers the schema of the data set from a sample of its rows.
+   *
+   * @param[in] options Settings for controlling reading behavior
+   * @param[in] sampling Number and size of the samples
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The inferred schema
+   */
+  table_schema infer_schema(json_reader_options const &options,
+                            schema_sampling_options const &sampling,
+                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
 }  // namespace json
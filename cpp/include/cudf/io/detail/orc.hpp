@@ -30,12 +30,16 @@ namespace orc {
 class reader {
  private:
   class impl;
-  std::unique_ptr<impl> _impl;
+  std::vector<std::unique_ptr<impl>> _impls;
+  rmm::mr::device_memory_resource* _mr = nullptr;
 
  public:
   /**
    * @brief Constructor from an array of file paths
    *
+   * The metadata of multiple files is parsed concurrently. Their columns must match, and they are
+   * read whole and concatenated in the given order.
+   *
    * @param filepaths Paths to the files containing the input dataset
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
@@ -47,6 +51,9 @@ class reader {
   /**
    * @brief Constructor from an array of datasources
    *
+   * The metadata of multiple sources is parsed concurrently. Their columns must match, and they
+   * are read whole and concatenated in the given order.
+   *
    * @param sources Input `datasource` objects to read the dataset from
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
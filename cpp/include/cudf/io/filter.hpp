@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file filter.hpp
+ * @brief cuDF-IO filter expressions evaluated against file statistics
+ */
+
+#pragma once
+
+#include <cudf/utilities/error.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+//! IO interfaces
+namespace io {
+/**
+ * @brief Comparison operators of filter expressions
+ */
+enum class filter_op {
+  EQUAL,          ///< column == literal
+  NOT_EQUAL,      ///< column != literal
+  LESS,           ///< column < literal
+  LESS_EQUAL,     ///< column <= literal
+  GREATER,        ///< column > literal
+  GREATER_EQUAL,  ///< column >= literal
+  IS_NULL,        ///< column is null; the literal is ignored
+  IS_NOT_NULL     ///< column is not null; the literal is ignored
+};
+
+/**
+ * @brief Literal value of a filter expression
+ *
+ * Literals are compared with the values as they are stored in the file: integers (including
+ * dates, timestamps in the time unit of the column, and decimals as unscaled values) with integer
+ * literals, floating-point values with numeric literals, and strings with string literals.
+ *
+ * Integer literals of any integral type are held as `int64_t`; unsigned values that exceed its
+ * range are rejected.
+ */
+class filter_literal {
+ public:
+  enum class kind { NONE, INTEGER, FLOAT, STRING };
+
+  filter_literal() = default;
+  template <typename T, typename std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  filter_literal(T value) : _kind(kind::INTEGER), _int_value(static_cast<int64_t>(value))
+  {
+    CUDF_EXPECTS(std::is_signed<T>::value ||
+                   static_cast<uint64_t>(value) <=
+                     static_cast<uint64_t>(std::numeric_limits<int64_t>::max()),
+                 "Integer literal out of range");
+  }
+  filter_literal(double value) : _kind(kind::FLOAT), _float_value(value) {}
+  filter_literal(std::string value) : _kind(kind::STRING), _string_value(std::move(value)) {}
+  filter_literal(char const* value) : _kind(kind::STRING), _string_value(value) {}
+
+  /**
+   * @brief Returns the kind of value held by the literal.
+   */
+  kind get_kind() const { return _kind; }
+
+  /**
+   * @brief Returns the value of an INTEGER literal.
+   */
+  int64_t get_int() const { return _int_value; }
+
+  /**
+   * @brief Returns the value of a FLOAT literal.
+   */
+  double get_float() const { return _float_value; }
+
+  /**
+   * @brief Returns the value of a STRING literal.
+   */
+  std::string const& get_string() const { return _string_value; }
+
+ private:
+  kind _kind          = kind::NONE;
+  int64_t _int_value  = 0;
+  double _float_value = 0;
+  std::string _string_value;
+};
+
+/**
+ * @brief Boolean expression over the columns of a file, used to skip the parts of the file (e.g.
+ * row groups or stripes) whose statistics show that no row can match.
+ *
+ * Filtering is conservative: parts without statistics for the filtered columns are always read,
+ * and the rows that are read are not filtered individually.
+ *
+ * The following code snippet builds the filter `ts >= 1000 AND ts < 2000`:
+ * @code
+ *  auto filter = cudf::io::filter_expression::all_of(
+ *    {cudf::io::filter_expression::compare("ts", cudf::io::filter_op::GREATER_EQUAL, 1000),
+ *     cudf::io::filter_expression::compare("ts", cudf::io::filter_op::LESS, 2000)});
+ * @endcode
+ */
+class filter_expression {
+ public:
+  enum class node_type { COMPARE, ALL_OF, ANY_OF };
+
+  /**
+   * @brief Default constructor; the expression matches all rows.
+   */
+  filter_expression() = default;
+
+  /**
+   * @brief Creates an expression that compares a column with a literal.
+   *
+   * @param column_name Name of the column; nested columns are named with their dot-separated path
+   * @param op Comparison operator
+   * @param literal Value to compare with
+   */
+  static filter_expression compare(std::string column_name,
+                                   filter_op op,
+                                   filter_literal literal = filter_literal{})
+  {
+    filter_expression expr;
+    expr._type        = node_type::COMPARE;
+    expr._column_name = std::move(column_name);
+    expr._op          = op;
+    expr._literal     = std::move(literal);
+    return expr;
+  }
+
+  /**
+   * @brief Creates an expression that matches the rows matched by all of the given expressions.
+   */
+  static filter_expression all_of(std::vector<filter_expression> children)
+  {
+    filter_expression expr;
+    expr._type     = node_type::ALL_OF;
+    expr._children = std::move(children);
+    return expr;
+  }
+
+  /**
+   * @brief Creates an expression that matches the rows matched by any of the given expressions.
+   */
+  static filter_expression any_of(std::vector<filter_expression> children)
+  {
+    filter_expression expr;
+    expr._type     = node_type::ANY_OF;
+    expr._children = std::move(children);
+    return expr;
+  }
+
+  /**
+   * @brief Returns true if the expression trivially matches all rows.
+   */
+  bool matches_all() const { return _type == node_type::ALL_OF && _children.empty(); }
+
+  /**
+   * @brief Returns the type of the expression node.
+   */
+  node_type get_type() const { return _type; }
+
+  /**
+   * @brief Returns the name of the compared column of a COMPARE node.
+   */
+  std::string const& get_column_name() const { return _column_name; }
+
+  /**
+   * @brief Returns the comparison operator of a COMPARE node.
+   */
+  filter_op get_op() const { return _op; }
+
+  /**
+   * @brief Returns the literal of a COMPARE node.
+   */
+  filter_literal const& get_literal() const { return _literal; }
+
+  /**
+   * @brief Returns the operands of an ALL_OF or ANY_OF node.
+   */
+  std::vector<filter_expression> const& get_children() const { return _children; }
+
+  /**
+   * @brief Returns the names of all columns referenced by the expression.
+   */
+  std::vector<std::string> get_column_names() const
+  {
+    std::vector<std::string> names;
+    if (_type == node_type::COMPARE) { names.push_back(_column_name); }
+    for (auto const& child : _children) {
+      auto child_names = child.get_column_names();
+      names.insert(names.end(), child_names.begin(), child_names.end());
+    }
+    return names;
+  }
+
+ private:
+  node_type _type = node_type::ALL_OF;
+  std::string _column_name;
+  filter_op _op = filter_op::EQUAL;
+  filter_literal _literal;
+  std::vector<filter_expression> _children;
+};
+
+}  // namespace io
+}  // namespace cudf
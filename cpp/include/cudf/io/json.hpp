@@ -309,6 +309,33 @@ table_with_metadata read_json(
   json_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Infers the column types of a JSON Lines dataset from a sample of its rows.
+ *
+ * Only the sampled rows are parsed. The returned schema can be cached, and passed to the `dtypes`
+ * option to read this or any other dataset of the same shape without type inference.
+ *
+ * The following code snippet demonstrates how to read a dataset with the inferred types:
+ * @code
+ *  auto options = cudf::io::json_reader_options::builder(cudf::source_info(filepath))
+ *                   .lines(true)
+ *                   .build();
+ *  auto schema = cudf::io::infer_json_schema(options);
+ *  options.dtypes(schema.dtypes);
+ *  auto result = cudf::io::read_json(options);
+ * @endcode
+ *
+ * @param options Settings for reading the dataset; the byte range is ignored
+ * @param sampling Number and size of the samples
+ * @param mr Device memory resource used to allocate device memory while reading the sample
+ *
+ * @return Column names and types of the dataset
+ */
+table_schema infer_json_schema(
+  json_reader_options const& options,
+  schema_sampling_options const& sampling = {},
+  rmm::mr::device_memory_resource* mr     = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
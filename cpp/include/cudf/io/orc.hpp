@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/io/filter.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -68,6 +69,9 @@ class orc_reader_options {
   // -1 is auto (column scale), >=0: number of fractional digits
   size_type _forced_decimals_scale = -1;
 
+  // Filter used to skip stripes based on their statistics
+  filter_expression _filter;
+
   friend orc_reader_options_builder;
 
   /**
@@ -143,6 +147,11 @@ class orc_reader_options {
    */
   size_type get_forced_decimals_scale() const { return _forced_decimals_scale; }
 
+  /**
+   * @brief Returns the filter used to skip stripes.
+   */
+  filter_expression const& get_filter() const { return _filter; }
+
   // Setters
 
   /**
@@ -220,6 +229,18 @@ class orc_reader_options {
    * @param val Length of fractional digits.
    */
   void set_forced_decimals_scale(size_type val) { _forced_decimals_scale = val; }
+
+  /**
+   * @brief Sets the filter used to skip stripes.
+   *
+   * Stripes whose column statistics show that none of their rows match the filter are not read.
+   * Rows of the stripes that are read are not filtered. Integer, floating-point, string and date
+   * columns can be filtered on; filters on other columns never skip stripes. Can't be combined
+   * with `skip_rows` and `num_rows`.
+   *
+   * @param filter Filter expression.
+   */
+  void set_filter(filter_expression filter) { _filter = std::move(filter); }
 };
 
 class orc_reader_options_builder {
@@ -348,6 +369,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the filter used to skip stripes.
+   *
+   * @param filter Filter expression.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& filter(filter_expression filter)
+  {
+    options._filter = std::move(filter);
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -384,6 +417,18 @@ table_with_metadata read_orc(
   orc_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Loads the timestamp conversion tables of the given timezones.
+ *
+ * Reading timestamps from an ORC file written in a non-UTC timezone requires the transition
+ * table of that timezone, built from the system's TZif files. Tables are built on first use and
+ * shared by all readers in the process; preloading them at startup moves this cost, and any error
+ * caused by a missing TZif file, out of the first reads.
+ *
+ * @param timezone_names Standard timezone names (for example, "America/Los_Angeles")
+ */
+void preload_orc_timezones(std::vector<std::string> const& timezone_names);
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/io/filter.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -68,6 +69,14 @@ class parquet_reader_options {
   // doubles for storage of types unsupported by cudf
   bool _strict_decimal_types = false;
 
+  // Whether to look up and store parsed file footers in the process-wide metadata cache
+  bool _use_metadata_cache = false;
+  // Cache keys of the sources; empty to derive keys from the file paths
+  std::vector<std::string> _metadata_cache_keys;
+
+  // Filter used to skip row groups based on their statistics
+  filter_expression _filter;
+
   /**
    * @brief Constructor from source info.
    *
@@ -140,6 +149,21 @@ class parquet_reader_options {
    */
   bool is_enabled_strict_decimal_types() const { return _strict_decimal_types; }
 
+  /**
+   * @brief Returns true if parsed file footers are looked up in and added to the metadata cache.
+   */
+  bool is_enabled_use_metadata_cache() const { return _use_metadata_cache; }
+
+  /**
+   * @brief Returns the metadata cache keys of the sources.
+   */
+  std::vector<std::string> const& get_metadata_cache_keys() const { return _metadata_cache_keys; }
+
+  /**
+   * @brief Returns the filter used to skip row groups.
+   */
+  filter_expression const& get_filter() const { return _filter; }
+
   /**
    * @brief Sets names of the columns to be read.
    *
@@ -217,6 +241,41 @@ class parquet_reader_options {
    * cudf will convert unsupported types to double.
    */
   void set_strict_decimal_types(bool val) { _strict_decimal_types = val; }
+
+  /**
+   * @brief Enables/disables use of the process-wide metadata cache.
+   *
+   * File sources are keyed by their path, size and modification time; other sources are only
+   * cached if keys are set with `set_metadata_cache_keys()`.
+   *
+   * @param val Boolean value whether to use the metadata cache.
+   */
+  void enable_use_metadata_cache(bool val) { _use_metadata_cache = val; }
+
+  /**
+   * @brief Sets the metadata cache keys of the sources, one per source.
+   *
+   * A key must identify the content of the source: a source whose content changes must be given a
+   * new key. An empty key excludes the corresponding source from caching.
+   *
+   * @param keys Vector of cache keys.
+   */
+  void set_metadata_cache_keys(std::vector<std::string> keys)
+  {
+    _metadata_cache_keys = std::move(keys);
+  }
+
+  /**
+   * @brief Sets the filter used to skip row groups.
+   *
+   * Row groups whose column chunk statistics show that none of their rows match the filter are
+   * not read. If the filtered columns have page indexes, the rows read are further narrowed down
+   * to the range of data pages whose statistics show that they may contain matching rows. Rows
+   * within that range are not filtered. Can't be combined with `skip_rows` and `num_rows`.
+   *
+   * @param filter Filter expression.
+   */
+  void set_filter(filter_expression filter) { _filter = std::move(filter); }
 };
 
 class parquet_reader_options_builder {
@@ -333,6 +392,42 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable use of the process-wide metadata cache.
+   *
+   * @param val Boolean value whether to use the metadata cache.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& use_metadata_cache(bool val)
+  {
+    options._use_metadata_cache = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the metadata cache keys of the sources, one per source.
+   *
+   * @param keys Vector of cache keys.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& metadata_cache_keys(std::vector<std::string> keys)
+  {
+    options._metadata_cache_keys = std::move(keys);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the filter used to skip row groups.
+   *
+   * @param filter Filter expression.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& filter(filter_expression filter)
+  {
+    options._filter = std::move(filter);
+    return *this;
+  }
+
   /**
    * @brief move parquet_reader_options member once it's built.
    */
@@ -369,6 +464,37 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Counters of the process-wide Parquet metadata cache.
+ */
+struct parquet_metadata_cache_stats {
+  size_t hits        = 0;  ///< Footers found in the cache
+  size_t misses      = 0;  ///< Footers looked up but not found in the cache
+  size_t evictions   = 0;  ///< Footers evicted to stay within the capacity
+  size_t num_entries = 0;  ///< Footers currently cached
+  size_t size        = 0;  ///< Total size of the encoded footers currently cached, in bytes
+  size_t capacity    = 0;  ///< Limit on `size`, in bytes
+};
+
+/**
+ * @brief Returns the counters of the Parquet metadata cache.
+ *
+ * The cache is only used by reads with `parquet_reader_options::is_enabled_use_metadata_cache()`.
+ */
+parquet_metadata_cache_stats get_parquet_metadata_cache_stats();
+
+/**
+ * @brief Sets the capacity of the Parquet metadata cache, evicting footers as needed.
+ *
+ * @param capacity Limit on the total size of the encoded footers kept in the cache, in bytes
+ */
+void set_parquet_metadata_cache_capacity(size_t capacity);
+
+/**
+ * @brief Removes all footers from the Parquet metadata cache.
+ */
+void clear_parquet_metadata_cache();
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -38,6 +38,7 @@ class RandomAccessFile;
 namespace cudf {
 //! IO interfaces
 namespace io {
+class chunked_host_buffer;
 class data_sink;
 class datasource;
 }  // namespace io
@@ -58,7 +59,9 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZSTD,    ///< Zstandard format, using LZ77 + Huffman + finite state entropy coding
+  LZ4      ///< LZ4 format, using byte-oriented LZ77
 };
 
 /**
@@ -71,6 +74,25 @@ enum class io_type {
   USER_IMPLEMENTED,  ///< Input/output is handled by a custom user class
 };
 
+/**
+ * @brief Method used by file sources to read data from the file
+ */
+enum class file_read_mode {
+  AUTO,           ///< Use `LIBCUDF_FILE_READ_MODE` environment variable; memory mapping if unset
+  MEMORY_MAPPED,  ///< Memory map the file and copy out of the mapping
+  POSITIONAL,     ///< Read with `pread()` directly into the destination buffer
+  DIRECT          ///< Read with `pread()` using O_DIRECT, bypassing the page cache
+};
+
+/**
+ * @brief When file sinks synchronize the written data to the storage device
+ */
+enum class file_sync_policy {
+  NONE,      ///< Leave writing back the data to the operating system
+  ON_CLOSE,  ///< Synchronize once all data has been written, when the sink is destroyed
+  ON_FLUSH   ///< Synchronize on every flush
+};
+
 /**
  * @brief Behavior when handling quotations in field data
  */
@@ -161,6 +183,28 @@ struct table_with_metadata {
   table_metadata metadata;
 };
 
+/**
+ * @brief Settings for sampling a dataset to infer its schema
+ *
+ * The samples are taken at evenly spaced positions of the dataset, the first one at its start.
+ * Compressed datasets are sampled from the start of the uncompressed data only.
+ */
+struct schema_sampling_options {
+  size_t num_samples  = 8;            //!< Number of positions that are sampled
+  size_t sample_bytes = 1024 * 1024;  //!< Number of bytes read at each position
+};
+
+/**
+ * @brief Schema of a dataset, inferred from a sample of its rows
+ *
+ * The schema can be reused to read any dataset of the same shape without type inference, by
+ * passing `dtypes` to the `dtypes` reader option.
+ */
+struct table_schema {
+  std::vector<std::string> column_names;  //!< Names of the columns
+  std::vector<std::string> dtypes;        //!< Type of each column, as a `name:type` string
+};
+
 /**
  * @brief Non-owning view of a host memory buffer
  *
@@ -182,6 +226,7 @@ struct source_info {
   std::vector<host_buffer> buffers;
   std::vector<std::shared_ptr<arrow::io::RandomAccessFile>> files;
   std::vector<cudf::io::datasource*> user_sources;
+  file_read_mode read_mode = file_read_mode::AUTO;  ///< How `filepaths` sources read the files
 
   source_info() = default;
 
@@ -193,6 +238,14 @@ struct source_info {
     : type(io_type::FILEPATH), filepaths({file_path})
   {
   }
+  explicit source_info(std::vector<std::string> const& file_paths, file_read_mode mode)
+    : type(io_type::FILEPATH), filepaths(file_paths), read_mode(mode)
+  {
+  }
+  explicit source_info(std::string const& file_path, file_read_mode mode)
+    : type(io_type::FILEPATH), filepaths({file_path}), read_mode(mode)
+  {
+  }
 
   explicit source_info(std::vector<host_buffer> const& host_buffers)
     : type(io_type::HOST_BUFFER), buffers(host_buffers)
@@ -219,15 +272,27 @@ struct source_info {
 struct sink_info {
   io_type type = io_type::VOID;
   std::string filepath;
-  std::vector<char>* buffer      = nullptr;
-  cudf::io::data_sink* user_sink = nullptr;
+  std::vector<char>* buffer           = nullptr;
+  chunked_host_buffer* chunked_buffer = nullptr;
+  cudf::io::data_sink* user_sink      = nullptr;
+  file_sync_policy sync_policy        = file_sync_policy::NONE;  ///< Sync policy of file sinks
 
   sink_info() = default;
 
   explicit sink_info(const std::string& file_path) : type(io_type::FILEPATH), filepath(file_path) {}
 
+  explicit sink_info(const std::string& file_path, file_sync_policy policy)
+    : type(io_type::FILEPATH), filepath(file_path), sync_policy(policy)
+  {
+  }
+
   explicit sink_info(std::vector<char>* buffer) : type(io_type::HOST_BUFFER), buffer(buffer) {}
 
+  explicit sink_info(chunked_host_buffer* buffer)
+    : type(io_type::HOST_BUFFER), chunked_buffer(buffer)
+  {
+  }
+
   explicit sink_info(class cudf::io::data_sink* user_sink_)
     : type(io_type::USER_IMPLEMENTED), user_sink(user_sink_)
   {
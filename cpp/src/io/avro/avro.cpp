@@ -46,6 +46,7 @@ std::string container::get_encoded()
 {
   auto const len = [&] {
     auto const len = get_encoded<uint64_t>();
+    if (!(len & 1) && (len >> 1) > static_cast<uint64_t>(m_end - m_cur)) { m_truncated = true; }
     return (len & 1) || (m_cur >= m_end) ? 0
                                          : std::min(len >> 1, static_cast<uint64_t>(m_end - m_cur));
   }();
@@ -54,20 +55,26 @@ std::string container::get_encoded()
   return std::string(s, len);
 }
 
+size_t find_sync_marker(uint8_t const *data, size_t len, uint64_t const sync_marker[2])
+{
+  auto const marker = reinterpret_cast<uint8_t const *>(sync_marker);
+  return std::search(data, data + len, marker, marker + 2 * sizeof(uint64_t)) - data;
+}
+
 /**
- * @Brief AVRO file metadata parser
+ * @Brief AVRO file header parser
+ *
+ * Parses the magic, the file metadata and the sync marker, and extracts the columns from the
+ * schema. On success, the container is positioned at the first block.
  *
  * @param md[out] parsed avro file metadata
- * @param max_num_rows[in] maximum number of rows
- * @param first_row[in] drop blocks below first_row
  *
- * @returns true if successful, false if error
+ * @returns true if successful, false if error or if the header extends past the end of the data
  */
-bool container::parse(file_metadata *md, size_t max_num_rows, size_t first_row)
+bool container::parse_header(file_metadata *md)
 {
   constexpr uint32_t avro_magic = (('O' << 0) | ('b' << 8) | ('j' << 16) | (0x01 << 24));
-  uint32_t sig4, max_block_size;
-  size_t total_object_count;
+  uint32_t sig4;
 
   sig4 = get_raw<uint8_t>();
   sig4 |= get_raw<uint8_t>() << 8;
@@ -93,34 +100,9 @@ bool container::parse(file_metadata *md, size_t max_num_rows, size_t first_row)
   }
   md->sync_marker[0] = get_raw<uint64_t>();
   md->sync_marker[1] = get_raw<uint64_t>();
+  if (m_truncated) { return false; }
 
-  md->metadata_size  = m_cur - m_base;
-  md->skip_rows      = 0;
-  max_block_size     = 0;
-  total_object_count = 0;
-  while (m_cur + 18 < m_end && total_object_count < max_num_rows) {
-    auto const object_count = static_cast<uint32_t>(get_encoded<int64_t>());
-    auto const block_size   = static_cast<uint32_t>(get_encoded<int64_t>());
-    if (block_size <= 0 || object_count <= 0 || m_cur + block_size + 16 > m_end) { break; }
-    if (object_count > first_row) {
-      uint32_t block_row = static_cast<uint32_t>(total_object_count);
-      max_block_size     = std::max(max_block_size, block_size);
-      total_object_count += object_count;
-      if (!md->block_list.size()) {
-        md->skip_rows = static_cast<uint32_t>(first_row);
-        total_object_count -= first_row;
-        first_row = 0;
-      }
-      md->block_list.emplace_back(m_cur - m_base, block_size, block_row, object_count);
-    } else {
-      first_row -= object_count;
-    }
-    m_cur += block_size;
-    m_cur += 16;  // TODO: Validate sync marker
-  }
-  md->max_block_size  = max_block_size;
-  md->num_rows        = total_object_count;
-  md->total_data_size = m_cur - (m_base + md->metadata_size);
+  md->metadata_size = m_cur - m_base;
   // Extract columns
   for (size_t i = 0; i < md->schema.size(); i++) {
     type_kind_e kind = md->schema[i].kind;
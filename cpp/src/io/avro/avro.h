@@ -94,6 +94,17 @@ class schema_parser {
   const char *m_end;
 };
 
+/**
+ * @Brief Returns the position of the first occurrence of a sync marker in a buffer
+ *
+ * @param data[in] buffer to search
+ * @param len[in] length of the buffer
+ * @param sync_marker[in] 16-byte sync marker of the file
+ *
+ * @returns position of the marker, or `len` if the buffer does not contain it
+ */
+size_t find_sync_marker(uint8_t const *data, size_t len, uint64_t const sync_marker[2]);
+
 /**
  * @Brief AVRO file container parsing class
  */
@@ -105,10 +116,18 @@ class container {
 
   auto bytecount() const { return m_cur - m_base; }
 
+  /**
+   * @Brief Returns true if a read extended past the end of the data
+   */
+  bool truncated() const { return m_truncated; }
+
   template <typename T>
   T get_raw()
   {
-    if (m_cur + sizeof(T) > m_end) return T{};
+    if (m_cur + sizeof(T) > m_end) {
+      m_truncated = true;
+      return T{};
+    }
     T val;
     memcpy(&val, m_cur, sizeof(T));
     m_cur += sizeof(T);
@@ -119,12 +138,13 @@ class container {
   T get_encoded();
 
  public:
-  bool parse(file_metadata *md, size_t max_num_rows = 0x7fffffff, size_t first_row = 0);
+  bool parse_header(file_metadata *md);
 
  protected:
   const uint8_t *m_base;
   const uint8_t *m_cur;
   const uint8_t *m_end;
+  bool m_truncated = false;
 };
 
 }  // namespace avro
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file chunked_state.hpp
+ * @brief definition for chunked state structure used by Avro reader
+ */
+
+#pragma once
+
+#include <cudf/io/avro.hpp>
+#include <cudf/io/detail/avro.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Chunked reader state struct. Contains the information needed across the
+ *        begin() / read() calls.
+ */
+struct avro_chunked_state {
+  /// The reader to be used; it keeps track of the next row to read
+  std::unique_ptr<detail::avro::reader> reader;
+  /// Maximum number of rows of each chunk
+  size_type chunk_rows = 0;
+  /// Cuda stream to be used
+  rmm::cuda_stream_view stream;
+};
+
+}  // namespace io
+}  // namespace cudf
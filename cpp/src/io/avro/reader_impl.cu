@@ -22,6 +22,8 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
+#include <io/utilities/host_parallel.hpp>
 
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/table/table.hpp>
@@ -32,6 +34,12 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
+
 using cudf::detail::device_span;
 
 namespace cudf {
@@ -61,29 +69,219 @@ type_id to_type_id(const avro::schema_entry *col)
   }
 }
 
+/**
+ * @brief Converts the number of rows to read from the reader options to a row count
+ */
+size_t to_row_count(size_type num_rows)
+{
+  return (num_rows > 0) ? num_rows : std::numeric_limits<size_t>::max();
+}
+
 }  // namespace
 
+/**
+ * @brief Block of the file, as recorded in the block index
+ */
+struct indexed_block {
+  size_t offset;     ///< Offset of the block data in the file
+  size_t first_row;  ///< Index of the first row of the block in the file
+  uint32_t size;     ///< Size of the block data in bytes
+  uint32_t num_rows;
+};
+
 /**
  * @brief A helper wrapper for Avro file metadata. Provides some additional
  * convenience methods for initializing and accessing the metadata and schema
+ *
+ * Only the file header and the headers of the blocks are read from the source; the blocks are
+ * indexed as far as needed by the row selections.
  */
 class metadata : public file_metadata {
+  /**
+   * @brief Buffers the reads of a thread that walks the blocks of the file
+   *
+   * Consecutive small blocks are covered by a single read, so their headers are read in batches.
+   * Past a large block, the sync marker and the header of the next block share one read.
+   */
+  class block_reader {
+   public:
+    explicit block_reader(datasource *src) : source(src) {}
+
+    /**
+     * @brief Returns the data at an offset, reading it from the source if it is not buffered
+     *
+     * @param[in] offset Offset of the data in the file
+     * @param[in] size Number of bytes needed; fewer are returned at the end of the file
+     *
+     * @return Pointer to the data and the number of bytes available
+     */
+    std::pair<uint8_t const *, size_t> read(size_t offset, size_t size)
+    {
+      auto const file_size = source->size();
+      offset               = std::min(offset, file_size);
+      size                 = std::min(size, file_size - offset);
+      if (buffer == nullptr || offset < buffer_offset ||
+          offset + size > buffer_offset + buffer->size()) {
+        buffer_offset = offset;
+        buffer = source->host_read(offset, std::min(std::max(size, header_batch_read_size),
+                                                    file_size - offset));
+      }
+      return {buffer->data() + (offset - buffer_offset), size};
+    }
+
+   private:
+    datasource *const source;
+    std::unique_ptr<datasource::buffer> buffer;
+    size_t buffer_offset = 0;
+  };
+
+  // Largest size of the file header that is read before the header is parsed
+  static constexpr size_t initial_header_read_size = 64 * 1024;
+  // Block headers hold the object count and the block size as two varints
+  static constexpr size_t max_block_header_size = 20;
+  static constexpr size_t sync_marker_size      = 16;
+  // Amount of data read at a time when indexing blocks; covers the headers of many small blocks
+  static constexpr size_t header_batch_read_size = 64 * 1024;
+  // Amount of data read at a time when searching for a sync marker
+  static constexpr size_t sync_search_read_size = 1024 * 1024;
+  // Smallest part of the file indexed by a thread
+  static constexpr size_t min_parallel_index_size = 64 * 1024 * 1024;
+
  public:
   explicit metadata(datasource *const src) : source(src) {}
 
   /**
-   * @brief Initializes the parser and filters down to a subset of rows
+   * @brief Parses the file header, reading only the beginning of the file
+   */
+  void init()
+  {
+    auto const file_size = source->size();
+    for (auto read_size = std::min(initial_header_read_size, file_size);; read_size *= 2) {
+      read_size         = std::min(read_size, file_size);
+      const auto buffer = source->host_read(0, read_size);
+      avro::container pod(buffer->data(), buffer->size());
+      static_cast<file_metadata &>(*this) = file_metadata{};
+      if (pod.parse_header(this)) { break; }
+      // The header may extend past the data that has been read so far
+      CUDF_EXPECTS(pod.truncated() && read_size < file_size, "Cannot parse metadata");
+    }
+    next_block_offset = metadata_size;
+    index_end_offset  = file_size;
+  }
+
+  /**
+   * @brief Restricts the block index to the blocks that start within a byte range
+   *
+   * Blocks start right after a sync marker, so the first block of the range is found by searching
+   * for the marker. Must be called before any block is indexed.
+   *
+   * @param[in] offset Offset of the range in the file
+   * @param[in] size Size of the range in bytes; zero for the rest of the file
+   */
+  void set_byte_range(size_t offset, size_t size)
+  {
+    auto const file_size = source->size();
+    offset               = std::min(offset, file_size);
+    index_end_offset     = (size != 0) ? offset + std::min(size, file_size - offset) : file_size;
+    next_block_offset    = find_block_start(offset, index_end_offset);
+  }
+
+  /**
+   * @brief Returns the number of rows in the blocks indexed so far
+   */
+  size_t num_indexed_rows() const { return indexed_rows; }
+
+  /**
+   * @brief Extends the block index until it covers at least a number of rows, or the whole range
+   *
+   * Indexing the whole range of a large file is split across threads, each one finding the first
+   * block of its part of the file by searching for the sync marker.
+   *
+   * @param[in] min_rows Number of rows to cover
+   */
+  void index_blocks(size_t min_rows)
+  {
+    if (indexed_rows >= min_rows || next_block_offset >= index_end_offset) { return; }
+
+    auto const remaining_size = index_end_offset - next_block_offset;
+    auto const num_parts =
+      (min_rows == std::numeric_limits<size_t>::max())
+        ? std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u),
+                           remaining_size / min_parallel_index_size)
+        : 0;
+    if (num_parts < 2) {
+      block_reader reader(source);
+      indexed_block blk;
+      while (indexed_rows < min_rows && next_block_offset < index_end_offset &&
+             read_block_header(reader, next_block_offset, blk, next_block_offset)) {
+        blk.first_row = indexed_rows;
+        indexed_rows += blk.num_rows;
+        block_index.push_back(blk);
+      }
+      if (indexed_rows < min_rows) { next_block_offset = index_end_offset; }
+      return;
+    }
+
+    std::vector<std::vector<indexed_block>> part_blocks(num_parts);
+    auto const index_start = next_block_offset;
+    host_parallel_for(num_parts, [&](size_t part) {
+      auto const begin = index_start + remaining_size * part / num_parts;
+      auto const end   = index_start + remaining_size * (part + 1) / num_parts;
+      auto offset      = (part == 0) ? begin : find_block_start(begin, end);
+      block_reader reader(source);
+      indexed_block blk;
+      while (offset < end && read_block_header(reader, offset, blk, offset)) {
+        part_blocks[part].push_back(blk);
+      }
+    });
+    for (auto &blocks : part_blocks) {
+      for (auto &blk : blocks) {
+        blk.first_row = indexed_rows;
+        indexed_rows += blk.num_rows;
+        block_index.push_back(blk);
+      }
+    }
+    next_block_offset = index_end_offset;
+  }
+
+  /**
+   * @brief Selects the blocks that contain a range of rows
    *
-   * @param[in,out] row_start Starting row of the selection
-   * @param[in,out] row_count Total number of rows selected
+   * Sets the block list, the rows to skip in the first block, and the number of rows to read.
+   *
+   * @param[in] row_start First row to read
+   * @param[in] row_count Number of rows to read
    */
-  void init_and_select_rows(int &row_start, int &row_count)
+  void select_rows(size_t row_start, size_t row_count)
   {
-    const auto buffer = source->host_read(0, source->size());
-    avro::container pod(buffer->data(), buffer->size());
-    CUDF_EXPECTS(pod.parse(this, row_count, row_start), "Cannot parse metadata");
-    row_start = skip_rows;
-    row_count = num_rows;
+    auto const row_end =
+      row_start + std::min(row_count, std::numeric_limits<size_t>::max() - row_start);
+    index_blocks(row_end);
+
+    block_list.clear();
+    skip_rows       = 0;
+    num_rows        = 0;
+    max_block_size  = 0;
+    total_data_size = 0;
+    if (row_start >= indexed_rows) { return; }
+
+    auto block = std::upper_bound(
+      block_index.begin(), block_index.end(), row_start, [](size_t row, auto const &blk) {
+        return row < blk.first_row + blk.num_rows;
+      });
+    auto const first = *block;
+    for (; block != block_index.end() && block->first_row < row_end; ++block) {
+      // Block rows are relative to the first selected block, including the skipped rows
+      block_list.emplace_back(block->offset,
+                              block->size,
+                              static_cast<uint32_t>(block->first_row - first.first_row),
+                              block->num_rows);
+      max_block_size = std::max(max_block_size, block->size);
+    }
+    auto const &last = block_list.back();
+    skip_rows        = static_cast<uint32_t>(row_start - first.first_row);
+    num_rows         = std::min(row_end, indexed_rows) - row_start;
+    total_data_size  = last.offset + last.size - first.offset;
   }
 
   /**
@@ -135,12 +333,110 @@ class metadata : public file_metadata {
   }
 
  private:
+  /**
+   * @brief Returns the offset of the first block that starts within a byte range, or the end of
+   * the range if there is none
+   */
+  size_t find_block_start(size_t offset, size_t end_offset) const
+  {
+    if (offset <= metadata_size) { return metadata_size; }
+    // A block that starts at `offset` is preceded by a marker that ends there
+    auto pos = offset - sync_marker_size;
+    while (pos + sync_marker_size <= end_offset) {
+      auto const read_size =
+        std::min(sync_search_read_size, end_offset - pos + sync_marker_size - 1);
+      auto const buffer = source->host_read(pos, std::min(read_size, source->size() - pos));
+      auto const found  = find_sync_marker(buffer->data(), buffer->size(), sync_marker);
+      if (found < buffer->size()) { return std::min(pos + found + sync_marker_size, end_offset); }
+      if (buffer->size() < read_size) { break; }
+      pos += buffer->size() - (sync_marker_size - 1);
+    }
+    return end_offset;
+  }
+
+  /**
+   * @brief Reads the header of a block and validates the sync marker that follows the block
+   *
+   * @param[in] reader Reader that buffers the block headers
+   * @param[in] offset Offset of the block header
+   * @param[out] blk Block description, without the row index
+   * @param[out] next_offset Offset of the next block
+   *
+   * @return false if there is no complete block at the offset
+   */
+  bool read_block_header(block_reader &reader,
+                         size_t offset,
+                         indexed_block &blk,
+                         size_t &next_offset) const
+  {
+    auto const file_size = source->size();
+    auto const header    = reader.read(offset, max_block_header_size);
+    avro::container pod(header.first, header.second);
+    auto const object_count = pod.get_encoded<int64_t>();
+    auto const block_size   = pod.get_encoded<int64_t>();
+    auto const data_offset  = offset + pod.bytecount();
+    if (pod.truncated() || block_size <= 0 || object_count <= 0 ||
+        data_offset + block_size + sync_marker_size > file_size) {
+      // End of the file, or a trailing partial block
+      return false;
+    }
+    // The marker is read together with the header of the next block
+    auto const marker =
+      reader.read(data_offset + block_size, sync_marker_size + max_block_header_size);
+    CUDF_EXPECTS(find_sync_marker(marker.first, sync_marker_size, sync_marker) == 0,
+                 "Invalid sync marker; the file is corrupted");
+
+    blk.offset   = data_offset;
+    blk.size     = static_cast<uint32_t>(block_size);
+    blk.num_rows = static_cast<uint32_t>(object_count);
+    next_offset  = data_offset + block_size + sync_marker_size;
+    return true;
+  }
+
   datasource *const source;
+  std::vector<indexed_block> block_index;
+  size_t indexed_rows      = 0;
+  size_t next_block_offset = 0;
+  size_t index_end_offset  = 0;  ///< Blocks that start at or after this offset are not indexed
 };
 
+constexpr size_t metadata::initial_header_read_size;
+constexpr size_t metadata::header_batch_read_size;
+constexpr size_t metadata::sync_search_read_size;
+
 rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_block_data,
                                                  rmm::cuda_stream_view stream)
 {
+  if (_metadata->codec == "zstandard") {
+    // No device decoder, and frames need not record their uncompressed size; the blocks are
+    // decompressed on the host
+    std::vector<uint8_t> comp_data(comp_block_data.size());
+    CUDA_TRY(cudaMemcpyAsync(comp_data.data(),
+                             comp_block_data.data(),
+                             comp_block_data.size(),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
+
+    const auto base_offset = _metadata->block_list[0].offset;
+    std::vector<std::vector<char>> blocks(_metadata->block_list.size());
+    host_parallel_for(blocks.size(), [&](size_t i) {
+      blocks[i] = io_uncompress_single_h2d(comp_data.data() + _metadata->block_list[i].offset -
+                                             base_offset,
+                                           _metadata->block_list[i].size,
+                                           IO_UNCOMP_STREAM_TYPE_ZSTD);
+    });
+
+    std::vector<char> decomp_data;
+    for (size_t i = 0; i < blocks.size(); i++) {
+      // Update blocks offsets & sizes to refer to uncompressed data
+      _metadata->block_list[i].offset = decomp_data.size();
+      _metadata->block_list[i].size   = static_cast<uint32_t>(blocks[i].size());
+      decomp_data.insert(decomp_data.end(), blocks[i].begin(), blocks[i].end());
+    }
+    return rmm::device_buffer(decomp_data.data(), decomp_data.size(), stream);
+  }
+
   size_t uncompressed_data_size = 0;
   hostdevice_vector<gpu_inflate_input_s> inflate_in(_metadata->block_list.size());
   hostdevice_vector<gpu_inflate_status_s> inflate_out(_metadata->block_list.size());
@@ -357,19 +653,49 @@ reader::impl::impl(std::unique_ptr<datasource> source,
 {
   // Open the source Avro dataset metadata
   _metadata = std::make_unique<metadata>(_source.get());
+  _metadata->init();
+  if (options.get_byte_range_offset() != 0 || options.get_byte_range_size() != 0) {
+    _metadata->set_byte_range(options.get_byte_range_offset(), options.get_byte_range_size());
+  }
+
+  auto const max_rows = std::numeric_limits<size_t>::max() - options.get_skip_rows();
+  _next_chunk_row      = options.get_skip_rows();
+  _chunks_end_row = _next_chunk_row + std::min(to_row_count(options.get_num_rows()), max_rows);
 }
 
 table_with_metadata reader::impl::read(avro_reader_options const &options,
                                        rmm::cuda_stream_view stream)
 {
-  auto skip_rows = options.get_skip_rows();
-  auto num_rows  = options.get_num_rows();
-  num_rows       = (num_rows != 0) ? num_rows : -1;
+  return read_rows(options.get_skip_rows(), to_row_count(options.get_num_rows()), stream);
+}
+
+bool reader::impl::has_next()
+{
+  _metadata->index_blocks(_next_chunk_row + 1);
+  return _next_chunk_row < _chunks_end_row && _next_chunk_row < _metadata->num_indexed_rows();
+}
+
+table_with_metadata reader::impl::read_chunk(size_type chunk_rows, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(chunk_rows > 0, "Chunk size must be positive");
+  auto const row_start = _next_chunk_row;
+  auto const row_count =
+    std::min<size_t>(chunk_rows, _chunks_end_row - std::min(row_start, _chunks_end_row));
+  auto result     = read_rows(row_start, row_count, stream);
+  _next_chunk_row = std::min(row_start + row_count, _metadata->num_indexed_rows());
+  return result;
+}
+
+table_with_metadata reader::impl::read_rows(size_t row_start,
+                                            size_t row_count,
+                                            rmm::cuda_stream_view stream)
+{
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata metadata_out;
 
-  // Select and read partial metadata / schema within the subset of rows
-  _metadata->init_and_select_rows(skip_rows, num_rows);
+  // Select the blocks within the subset of rows
+  _metadata->select_rows(row_start, row_count);
+  auto const num_rows = _metadata->num_rows;
 
   // Select only columns required by the options
   auto selected_columns = _metadata->select_columns(_columns);
@@ -484,7 +810,8 @@ reader::reader(std::vector<std::string> const &filepaths,
                rmm::mr::device_memory_resource *mr)
 {
   CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(datasource::create(filepaths[0]), options, mr);
+  _impl = std::make_unique<impl>(
+    datasource::create(filepaths[0], 0, 0, options.get_source().read_mode), options, mr);
 }
 
 // Forward to implementation
@@ -504,6 +831,15 @@ table_with_metadata reader::read(avro_reader_options const &options, rmm::cuda_s
 {
   return _impl->read(options, stream);
 }
+
+// Forward to implementation
+bool reader::has_next() { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata reader::read_chunk(size_type chunk_rows, rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(chunk_rows, stream);
+}
 }  // namespace avro
 }  // namespace detail
 }  // namespace io
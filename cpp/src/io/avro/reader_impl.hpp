@@ -74,7 +74,33 @@ class reader::impl {
    */
   table_with_metadata read(avro_reader_options const &options, rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Returns true if a chunked read has rows left to read
+   */
+  bool has_next();
+
+  /**
+   * @brief Reads the next chunk of rows within the rows selected by the reader options
+   *
+   * @param chunk_rows Maximum number of rows to read
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(size_type chunk_rows, rmm::cuda_stream_view stream);
+
  private:
+  /**
+   * @brief Reads a range of rows, reading and decoding only the blocks that contain them
+   *
+   * @param row_start First row to read
+   * @param row_count Number of rows to read
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_rows(size_t row_start, size_t row_count, rmm::cuda_stream_view stream);
+
   /**
    * @brief Decompresses the block data.
    *
@@ -109,6 +135,10 @@ class reader::impl {
   std::unique_ptr<metadata> _metadata;
 
   std::vector<std::string> _columns;
+
+  // Row range of a chunked read
+  size_t _next_chunk_row = 0;
+  size_t _chunks_end_row = 0;
 };
 
 }  // namespace avro
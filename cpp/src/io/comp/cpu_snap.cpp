@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cpu_snap.h"
+
+#include <cudf/utilities/error.hpp>
+
+#include <string.h>  // memcpy
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace {
+// Matches are only searched within fragments of this size, so that offsets fit in 16 bits
+constexpr size_t fragment_size = 1 << 16;
+constexpr uint32_t hash_bits   = 14;
+constexpr uint32_t min_match   = 4;
+
+inline uint32_t load32(uint8_t const *p)
+{
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint64_t load64(uint8_t const *p)
+{
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint32_t hash4(uint32_t v) { return (v * 0x1e35a7bd) >> (32 - hash_bits); }
+
+uint8_t *emit_literal(uint8_t *dst, uint8_t const *src, size_t len)
+{
+  auto n = len - 1;
+  if (n < 60) {
+    *dst++ = static_cast<uint8_t>(n << 2);
+  } else {
+    // Tags 60..63 are followed by 1..4 bytes of length
+    uint8_t *tag    = dst++;
+    uint32_t nbytes = 0;
+    while (n > 0) {
+      *dst++ = static_cast<uint8_t>(n);
+      n >>= 8;
+      nbytes++;
+    }
+    *tag = static_cast<uint8_t>((59 + nbytes) << 2);
+  }
+  memcpy(dst, src, len);
+  return dst + len;
+}
+
+uint8_t *emit_copy_upto64(uint8_t *dst, size_t offset, size_t len)
+{
+  if (len < 12 && offset < 2048) {
+    // 3-bit length, 11-bit offset
+    *dst++ = static_cast<uint8_t>(1 | ((len - 4) << 2) | ((offset >> 8) << 5));
+    *dst++ = static_cast<uint8_t>(offset);
+  } else {
+    // 6-bit length, 16-bit offset
+    *dst++ = static_cast<uint8_t>(2 | ((len - 1) << 2));
+    *dst++ = static_cast<uint8_t>(offset);
+    *dst++ = static_cast<uint8_t>(offset >> 8);
+  }
+  return dst;
+}
+
+uint8_t *emit_copy(uint8_t *dst, size_t offset, size_t len)
+{
+  // Split long matches, leaving at least `min_match` bytes for the last copy
+  while (len >= 64 + min_match) {
+    dst = emit_copy_upto64(dst, offset, 64);
+    len -= 64;
+  }
+  if (len > 64) {
+    dst = emit_copy_upto64(dst, offset, 60);
+    len -= 60;
+  }
+  return emit_copy_upto64(dst, offset, len);
+}
+
+/**
+ * @brief Returns the length of the common prefix of `a` and `b`, up to `a_end`.
+ */
+inline size_t match_length(uint8_t const *a, uint8_t const *b, uint8_t const *a_end)
+{
+  auto const start = a;
+  while (a + sizeof(uint64_t) <= a_end) {
+    auto const diff = load64(a) ^ load64(b);
+    if (diff != 0) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      return (a - start) + (__builtin_ctzll(diff) >> 3);
+#else
+      break;
+#endif
+    }
+    a += sizeof(uint64_t);
+    b += sizeof(uint64_t);
+  }
+  while (a < a_end && *a == *b) {
+    a++;
+    b++;
+  }
+  return a - start;
+}
+
+uint8_t *compress_fragment(uint8_t const *src, size_t len, uint8_t *dst, uint16_t *table)
+{
+  std::fill(table, table + (1 << hash_bits), 0);
+  uint8_t const *const end = src + len;
+  size_t lit_start         = 0;
+  size_t pos               = 0;
+  while (pos + min_match <= len) {
+    auto const v      = load32(src + pos);
+    auto const h      = hash4(v);
+    size_t const cand = table[h];
+    table[h]          = static_cast<uint16_t>(pos);
+    if (cand < pos && load32(src + cand) == v) {
+      auto const m =
+        min_match + match_length(src + pos + min_match, src + cand + min_match, end);
+      if (lit_start < pos) { dst = emit_literal(dst, src + lit_start, pos - lit_start); }
+      dst = emit_copy(dst, pos - cand, m);
+      pos += m;
+      lit_start = pos;
+    } else {
+      // Step faster through data that does not compress
+      pos += 1 + ((pos - lit_start) >> 5);
+    }
+  }
+  if (lit_start < len) { dst = emit_literal(dst, src + lit_start, len - lit_start); }
+  return dst;
+}
+
+}  // namespace
+
+size_t cpu_snappy_max_compressed_size(size_t uncomp_size)
+{
+  return 32 + uncomp_size + uncomp_size / 6;
+}
+
+size_t cpu_snappy_compress(uint8_t const *src, size_t src_len, uint8_t *dst)
+{
+  CUDF_EXPECTS(src_len <= std::numeric_limits<uint32_t>::max(),
+               "Snappy blocks are limited to 4GB");
+  auto out = dst;
+  // Uncompressed length (varint)
+  auto v = src_len;
+  while (v >= 0x80) {
+    *out++ = static_cast<uint8_t>(v | 0x80);
+    v >>= 7;
+  }
+  *out++ = static_cast<uint8_t>(v);
+
+  std::vector<uint16_t> table(1 << hash_bits);
+  for (size_t pos = 0; pos < src_len; pos += fragment_size) {
+    out = compress_fragment(
+      src + pos, std::min(fragment_size, src_len - pos), out, table.data());
+  }
+  return out - dst;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Returns the largest size of the Snappy-compressed representation of a block
+ *
+ * @param uncomp_size Size of the uncompressed block
+ */
+size_t cpu_snappy_max_compressed_size(size_t uncomp_size);
+
+/**
+ * @brief Compresses a block of data in the Snappy format on the host
+ *
+ * @param src Uncompressed data
+ * @param src_len Size of the uncompressed data; must not exceed 4GB
+ * @param dst Output buffer of at least `cpu_snappy_max_compressed_size(src_len)` bytes
+ *
+ * @returns Size of the compressed data
+ */
+size_t cpu_snappy_compress(uint8_t const *src, size_t src_len, uint8_t *dst);
+
+}  // namespace io
+}  // namespace cudf
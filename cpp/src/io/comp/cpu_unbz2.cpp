@@ -81,10 +81,15 @@ For more information on these sources, see the manual.
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <memory>
 #include <vector>
 #include "io_uncomp.h"
 #include "unbz2.h"
 
+#include <io/utilities/host_parallel.hpp>
+
 namespace cudf {
 namespace io {
 
@@ -363,6 +368,8 @@ int32_t bz2_decompress_block(unbz_state_s *s)
       if (zvec >= BZ_MAX_ALPHA_SIZE) return BZ_DATA_ERROR;
       nextSym = gSel->perm[zvec];
       if (nextSym > BZ_RUNB) break;
+      // Bounds the run length, so that `es` cannot wrap around past the block size check
+      if (N >= 2 * 1024 * 1024) return BZ_DATA_ERROR;
       es += N << nextSym;
       N <<= 1;
     }
@@ -592,5 +599,194 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+namespace {
+constexpr uint64_t bz_block_magic = 0x314159265359ull;
+constexpr uint64_t bz_eos_magic   = 0x177245385090ull;
+// Input bytes scanned for block signatures by each task
+constexpr size_t bz_scan_chunk_size = 1 << 20;
+
+// Returns the 64 bits starting at the given byte, zero-padded past the end of the input
+inline uint64_t load64_be(const uint8_t *src, size_t len, size_t byte)
+{
+  if (byte + 8 <= len) {
+    uint64_t v;
+    memcpy(&v, src + byte, sizeof(v));
+    return __builtin_bswap64(v);
+  }
+  uint64_t v = 0;
+  for (size_t i = 0; i < 8; i++) { v = (v << 8) | ((byte + i < len) ? src[byte + i] : 0); }
+  return v;
+}
+
+// Returns the 48 bits starting at the given bit offset
+inline uint64_t peek48(const uint8_t *src, size_t len, uint64_t bit)
+{
+  return (load64_be(src, len, bit >> 3) << (bit & 7)) >> 16;
+}
+
+bool is_stream_header(const uint8_t *src, size_t len, size_t pos)
+{
+  return pos + 4 <= len && src[pos] == BZ_HDR_B && src[pos + 1] == BZ_HDR_Z &&
+         src[pos + 2] == BZ_HDR_h && src[pos + 3] >= BZ_HDR_0 + 1 && src[pos + 3] <= BZ_HDR_0 + 9;
+}
+
+struct bz2_block_s {
+  uint64_t bit_start      = 0;
+  uint64_t bit_end        = 0;  // Start of the following block, or past the end-of-stream signature
+  uint32_t block_size100k = 0;  // Block size the block is decoded with
+  int32_t status          = BZ_DATA_ERROR;
+  std::vector<char> data;
+};
+
+/**
+ * @brief Decodes the single block that starts at `blk->bit_start`, from a stream of the given
+ * block size.
+ */
+void decode_block(const uint8_t *source,
+                  size_t sourceLen,
+                  uint32_t block_size100k,
+                  bz2_block_s *blk)
+{
+  blk->block_size100k = block_size100k;
+  blk->status         = BZ_DATA_ERROR;
+  auto s = std::make_unique<unbz_state_s>();
+  // We will not read the final combined CRC (last 4 bytes of the file)
+  s->base   = source;
+  s->end    = source + sourceLen - 4;
+  s->cur    = source + (blk->bit_start >> 3);
+  s->bitpos = static_cast<uint32_t>(blk->bit_start & 7);
+  if (s->cur + 8 > s->end) { return; }
+  s->bitbuf        = load64_be(source, sourceLen, blk->bit_start >> 3);
+  s->blockSize100k = block_size100k;
+  s->tt.resize(s->blockSize100k * 100000);
+
+  auto ret = bz2_decompress_block(s.get());
+  if (ret != BZ_OK && ret != BZ_STREAM_END) {
+    blk->status = ret;
+    return;
+  }
+  blk->bit_end = ((s->cur - s->base) << 3) + s->bitpos;
+
+  // Undo the initial RLE, growing the output once if the first estimate is too small
+  blk->data.resize(s->save_nblock + s->save_nblock / 4);
+  for (int pass = 0; pass < 2; pass++) {
+    s->outbase = reinterpret_cast<uint8_t *>(blk->data.data());
+    s->out     = s->outbase;
+    s->outend  = s->outbase + blk->data.size();
+    bzUnRLE(s.get());
+    if (s->nblock_used != s->save_nblock + 1) {
+      blk->status = BZ_UNEXPECTED_EOF;
+      return;
+    }
+    auto const out_len = static_cast<size_t>(s->out - s->outbase);
+    if (out_len <= blk->data.size()) {
+      blk->data.resize(out_len);
+      break;
+    }
+    blk->data.resize(out_len);
+  }
+  blk->status = ret;
+}
+
+}  // namespace
+
+bz2_block_decoder::bz2_block_decoder(const uint8_t *input, size_t inlen)
+  : input(input), inlen(inlen)
+{
+  if (input == nullptr || inlen < 12) {
+    status = BZ_PARAM_ERROR;
+    return;
+  }
+  if (!start_stream(0)) {
+    status = BZ_DATA_ERROR_MAGIC;
+    return;
+  }
+  // Scan for block signatures at every bit offset, in parallel over chunks of the input
+  auto const num_chunks = (inlen + bz_scan_chunk_size - 1) / bz_scan_chunk_size;
+  std::vector<std::vector<uint64_t>> chunk_candidates(num_chunks);
+  host_parallel_for(num_chunks, [&](size_t c) {
+    auto const end = std::min(inlen, (c + 1) * bz_scan_chunk_size);
+    for (size_t byte = c * bz_scan_chunk_size; byte < end; byte++) {
+      auto const bits = load64_be(input, inlen, byte);
+      for (uint32_t k = 0; k < 8; k++) {
+        if (((bits << k) >> 16) == bz_block_magic) { chunk_candidates[c].push_back(byte * 8 + k); }
+      }
+    }
+  });
+  for (auto const &c : chunk_candidates) {
+    candidates.insert(candidates.end(), c.begin(), c.end());
+  }
+}
+
+bool bz2_block_decoder::start_stream(size_t byte_pos)
+{
+  if (!is_stream_header(input, inlen, byte_pos)) { return false; }
+  cur_bit        = (byte_pos + 4) * 8;
+  block_size100k = input[byte_pos + 3] - BZ_HDR_0;
+  return true;
+}
+
+int32_t bz2_block_decoder::decode(size_t max_blocks, std::vector<char> &dst)
+{
+  // Only as many blocks as there are threads are decoded and held at once
+  auto const wave_size = host_parallel_concurrency();
+  auto const batch     = std::max<size_t>(max_blocks, 1);
+  for (size_t decoded = 0; status == BZ_OK && decoded < batch; decoded += wave_size) {
+    decode_wave(std::min(wave_size, batch - decoded), dst);
+  }
+  return status;
+}
+
+void bz2_block_decoder::decode_wave(size_t batch, std::vector<char> &dst)
+{
+  // Speculatively decode the next candidate blocks in parallel, with the block size of the
+  // current stream
+  auto const first = static_cast<size_t>(
+    std::lower_bound(candidates.begin(), candidates.end(), cur_bit) - candidates.begin());
+  auto const count = std::min(batch, candidates.size() - first);
+  std::vector<bz2_block_s> blocks(count);
+  host_parallel_for(count, [&](size_t i) {
+    blocks[i].bit_start = candidates[first + i];
+    decode_block(input, inlen, block_size100k, &blocks[i]);
+  });
+
+  // Follow the chain of blocks from the current position
+  size_t i = 0;
+  while (true) {
+    bool end_of_stream = false;
+    if (peek48(input, inlen, cur_bit) == bz_eos_magic) {
+      // Stream without blocks
+      cur_bit += 48;
+      end_of_stream = true;
+    } else {
+      while (i < count && blocks[i].bit_start < cur_bit) { i++; }
+      if (i == count) {
+        // Blocks remain to be decoded, unless the file ends without an end-of-stream signature
+        status = (count == batch) ? BZ_OK : BZ_UNEXPECTED_EOF;
+        return;
+      }
+      auto &blk = blocks[i];
+      if (blk.bit_start == cur_bit && blk.block_size100k != block_size100k) {
+        // Decoded ahead of the start of a stream with a different block size
+        decode_block(input, inlen, block_size100k, &blk);
+      }
+      if (blk.bit_start != cur_bit || (blk.status != BZ_OK && blk.status != BZ_STREAM_END)) {
+        status = (blk.bit_start != cur_bit) ? BZ_DATA_ERROR : blk.status;
+        return;
+      }
+      dst.insert(dst.end(), blk.data.begin(), blk.data.end());
+      cur_bit       = blk.bit_end;
+      end_of_stream = (blk.status == BZ_STREAM_END);
+    }
+    if (end_of_stream) {
+      // Skip the combined CRC and the padding to a byte boundary; another stream may follow
+      if (!start_stream((cur_bit + 32 + 7) >> 3)) {
+        status = BZ_STREAM_END;
+        return;
+      }
+    }
+  }
+}
+
 }  // namespace io
 }  // namespace cudf
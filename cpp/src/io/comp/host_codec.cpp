@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file host_codec.cpp
+ * @brief Host block compressors, and host fallbacks for the device (de)compression interfaces
+ */
+
+#include "cpu_snap.h"
+#include "io_uncomp.h"
+
+#include <io/utilities/host_parallel.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <lz4.h>
+#include <zstd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+/**
+ * @Brief SNAPPY host compressor class
+ */
+class HostCompressor_SNAPPY : public HostCompressor {
+ public:
+  size_t Compress(uint8_t *dstBytes,
+                  size_t dstLen,
+                  const uint8_t *srcBytes,
+                  size_t srcLen) override
+  {
+    // The encoder needs room for the worst case; stage the output if the destination is smaller
+    if (dstLen >= cpu_snappy_max_compressed_size(srcLen)) {
+      return cpu_snappy_compress(srcBytes, srcLen, dstBytes);
+    }
+    m_buf.resize(cpu_snappy_max_compressed_size(srcLen));
+    auto const comp_len = cpu_snappy_compress(srcBytes, srcLen, m_buf.data());
+    if (comp_len > dstLen) { return 0; }
+    memcpy(dstBytes, m_buf.data(), comp_len);
+    return comp_len;
+  }
+
+ protected:
+  std::vector<uint8_t> m_buf;
+};
+
+/**
+ * @Brief ZSTD host compressor class
+ */
+class HostCompressor_ZSTD : public HostCompressor {
+ public:
+  HostCompressor_ZSTD() : m_cctx(ZSTD_createCCtx())
+  {
+    CUDF_EXPECTS(m_cctx != nullptr, "Failed to create ZSTD compression context");
+  }
+  ~HostCompressor_ZSTD() override { ZSTD_freeCCtx(m_cctx); }
+
+  size_t Compress(uint8_t *dstBytes,
+                  size_t dstLen,
+                  const uint8_t *srcBytes,
+                  size_t srcLen) override
+  {
+    auto const comp_len =
+      ZSTD_compressCCtx(m_cctx, dstBytes, dstLen, srcBytes, srcLen, ZSTD_CLEVEL_DEFAULT);
+    return ZSTD_isError(comp_len) ? 0 : comp_len;
+  }
+
+ protected:
+  ZSTD_CCtx *const m_cctx;
+};
+
+/**
+ * @Brief LZ4 host compressor class, producing raw LZ4 blocks
+ */
+class HostCompressor_LZ4 : public HostCompressor {
+ public:
+  size_t Compress(uint8_t *dstBytes,
+                  size_t dstLen,
+                  const uint8_t *srcBytes,
+                  size_t srcLen) override
+  {
+    if (srcLen > LZ4_MAX_INPUT_SIZE) { return 0; }
+    auto const comp_len =
+      LZ4_compress_default(reinterpret_cast<const char *>(srcBytes),
+                           reinterpret_cast<char *>(dstBytes),
+                           static_cast<int>(srcLen),
+                           static_cast<int>(std::min<size_t>(dstLen, LZ4_compressBound(srcLen))));
+    return (comp_len > 0) ? comp_len : 0;
+  }
+};
+
+/**
+ * @Brief Create a host compressor object
+ *
+ * @param[in] stream_type compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ *
+ * @returns corresponding HostCompressor class
+ */
+std::unique_ptr<HostCompressor> HostCompressor::Create(int stream_type)
+{
+  switch (stream_type) {
+    case IO_UNCOMP_STREAM_TYPE_SNAPPY: return std::make_unique<HostCompressor_SNAPPY>();
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: return std::make_unique<HostCompressor_ZSTD>();
+    case IO_UNCOMP_STREAM_TYPE_LZ4: return std::make_unique<HostCompressor_LZ4>();
+  }
+  CUDF_FAIL("Unsupported compression type");
+}
+
+void host_compress(int stream_type,
+                   host_span<gpu_inflate_input_s const> inputs,
+                   host_span<gpu_inflate_status_s> outputs)
+{
+  CUDF_EXPECTS(inputs.size() == outputs.size(), "Mismatched number of inputs and outputs");
+  // Validates the stream type before any work is queued
+  HostCompressor::Create(stream_type);
+
+  host_parallel_for(inputs.size(), [&](size_t i) {
+    auto const &in    = inputs[i];
+    auto &out         = outputs[i];
+    out.bytes_written = HostCompressor::Create(stream_type)
+                          ->Compress(static_cast<uint8_t *>(in.dstDevice),
+                                     in.dstSize,
+                                     static_cast<uint8_t const *>(in.srcDevice),
+                                     in.srcSize);
+    out.status        = (out.bytes_written != 0) ? 0 : 1;
+    out.reserved      = 0;
+  });
+}
+
+namespace {
+/**
+ * @brief Runs a host (de)compression function on blocks in device memory
+ *
+ * The source blocks are copied to host memory, `process` is called with the corresponding host
+ * blocks, and the first `bytes_written` bytes of each destination block and the statuses are
+ * copied back to device memory.
+ */
+template <typename Process>
+void process_device_blocks(gpu_inflate_input_s *inputs,
+                           gpu_inflate_status_s *outputs,
+                           int count,
+                           rmm::cuda_stream_view stream,
+                           Process process)
+{
+  if (count <= 0) { return; }
+  std::vector<gpu_inflate_input_s> device_args(count);
+  CUDA_TRY(cudaMemcpyAsync(device_args.data(),
+                           inputs,
+                           count * sizeof(gpu_inflate_input_s),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  size_t src_size = 0;
+  size_t dst_size = 0;
+  for (auto const &arg : device_args) {
+    src_size += arg.srcSize;
+    dst_size += arg.dstSize;
+  }
+  std::vector<uint8_t> src_data(src_size);
+  std::vector<uint8_t> dst_data(dst_size);
+  std::vector<gpu_inflate_input_s> host_args(count);
+  for (size_t i = 0, src_pos = 0, dst_pos = 0; i < host_args.size(); ++i) {
+    host_args[i].srcDevice = src_data.data() + src_pos;
+    host_args[i].srcSize   = device_args[i].srcSize;
+    host_args[i].dstDevice = dst_data.data() + dst_pos;
+    host_args[i].dstSize   = device_args[i].dstSize;
+    CUDA_TRY(cudaMemcpyAsync(src_data.data() + src_pos,
+                             device_args[i].srcDevice,
+                             device_args[i].srcSize,
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    src_pos += device_args[i].srcSize;
+    dst_pos += device_args[i].dstSize;
+  }
+  stream.synchronize();
+
+  std::vector<gpu_inflate_status_s> host_status(count);
+  process(host_span<gpu_inflate_input_s const>(host_args),
+          host_span<gpu_inflate_status_s>(host_status));
+
+  for (size_t i = 0; i < host_args.size(); ++i) {
+    if (host_status[i].status != 0) { continue; }
+    CUDA_TRY(cudaMemcpyAsync(device_args[i].dstDevice,
+                             host_args[i].dstDevice,
+                             host_status[i].bytes_written,
+                             cudaMemcpyHostToDevice,
+                             stream.value()));
+  }
+  CUDA_TRY(cudaMemcpyAsync(outputs,
+                           host_status.data(),
+                           count * sizeof(gpu_inflate_status_s),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  // The host buffers are released on return
+  stream.synchronize();
+}
+
+}  // namespace
+
+void host_decompress_device(int stream_type,
+                            gpu_inflate_input_s *inputs,
+                            gpu_inflate_status_s *outputs,
+                            int count,
+                            rmm::cuda_stream_view stream)
+{
+  process_device_blocks(inputs, outputs, count, stream, [&](auto host_inputs, auto host_outputs) {
+    host_decompress(stream_type, host_inputs, host_outputs);
+  });
+}
+
+void host_compress_device(int stream_type,
+                          gpu_inflate_input_s *inputs,
+                          gpu_inflate_status_s *outputs,
+                          int count,
+                          rmm::cuda_stream_view stream)
+{
+  process_device_blocks(inputs, outputs, count, stream, [&](auto host_inputs, auto host_outputs) {
+    host_compress(stream_type, host_inputs, host_outputs);
+  });
+}
+
+bool prefer_host_decompression()
+{
+  auto const env = std::getenv("LIBCUDF_HOST_DECOMPRESSION");
+  if (env == nullptr) { return false; }
+  auto const value = std::string(env);
+  if (value == "ON") { return true; }
+  if (value == "OFF") { return false; }
+  CUDF_FAIL("Invalid LIBCUDF_HOST_DECOMPRESSION value: " + value);
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -16,34 +16,94 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include <cudf/utilities/span.hpp>
 
+#include "gpuinflate.h"
+
 using cudf::detail::host_span;
 
 namespace cudf {
 namespace io {
 enum {
-  IO_UNCOMP_STREAM_TYPE_INFER   = 0,
-  IO_UNCOMP_STREAM_TYPE_GZIP    = 1,
-  IO_UNCOMP_STREAM_TYPE_ZIP     = 2,
-  IO_UNCOMP_STREAM_TYPE_BZIP2   = 3,
-  IO_UNCOMP_STREAM_TYPE_XZ      = 4,
-  IO_UNCOMP_STREAM_TYPE_INFLATE = 5,
-  IO_UNCOMP_STREAM_TYPE_SNAPPY  = 6,
-  IO_UNCOMP_STREAM_TYPE_BROTLI  = 7,
-  IO_UNCOMP_STREAM_TYPE_LZ4     = 8,
-  IO_UNCOMP_STREAM_TYPE_LZO     = 9,
-  IO_UNCOMP_STREAM_TYPE_ZSTD    = 10,
+  IO_UNCOMP_STREAM_TYPE_INFER      = 0,
+  IO_UNCOMP_STREAM_TYPE_GZIP       = 1,
+  IO_UNCOMP_STREAM_TYPE_ZIP        = 2,
+  IO_UNCOMP_STREAM_TYPE_BZIP2      = 3,
+  IO_UNCOMP_STREAM_TYPE_XZ         = 4,
+  IO_UNCOMP_STREAM_TYPE_INFLATE    = 5,
+  IO_UNCOMP_STREAM_TYPE_SNAPPY     = 6,
+  IO_UNCOMP_STREAM_TYPE_BROTLI     = 7,
+  IO_UNCOMP_STREAM_TYPE_LZ4        = 8,
+  IO_UNCOMP_STREAM_TYPE_LZO        = 9,
+  IO_UNCOMP_STREAM_TYPE_ZSTD       = 10,
+  IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP = 11,  // Hadoop-framed LZ4 blocks, or a raw LZ4 block
 };
 
 std::vector<char> io_uncompress_single_h2d(void const* src, size_t src_size, int stream_type);
 
+/**
+ * @brief Decompresses a gzip, zip or bzip2 file stored in host memory
+ *
+ * All the members of multi-member gzip files and all the files of zip archives are decompressed
+ * and concatenated. Members whose boundaries are known in advance (zip files and BGZF members)
+ * are decompressed in parallel.
+ *
+ * @param data Compressed file
+ * @param compression Compression type ("gzip", "zip", "bz2"), or "infer" to detect it
+ *
+ * @return The uncompressed data
+ */
 std::vector<char> get_uncompressed_data(host_span<char const> data, std::string const& compression);
 
+/**
+ * @brief Returns the IO_UNCOMP_STREAM_TYPE_XXX for a compression name such as "gzip" or "bz2"
+ *
+ * Unknown names map to IO_UNCOMP_STREAM_TYPE_INFER.
+ */
+int to_stream_type(std::string const& compression);
+
+/**
+ * @brief Decompresses a gzip, zip or bzip2 file stored in host memory incrementally
+ *
+ * Unlike `get_uncompressed_data()`, the uncompressed data is produced on demand, so readers can
+ * process compressed inputs in fixed-size windows and stop early without materializing the whole
+ * uncompressed file.
+ */
+class stream_decompressor {
+ public:
+  virtual ~stream_decompressor() {}
+
+  /**
+   * @brief Decompresses the next bytes of the stream.
+   *
+   * @param dst Output buffer
+   *
+   * @return Number of bytes written; less than `dst.size()` only at the end of the stream
+   */
+  virtual size_t read(host_span<char> dst) = 0;
+
+  /**
+   * @brief Returns whether all the uncompressed data has been read.
+   */
+  virtual bool eof() const = 0;
+};
+
+/**
+ * @brief Creates a streaming decompressor for a compressed file stored in host memory
+ *
+ * @param data Compressed file; must outlive the decompressor
+ * @param compression Compression type ("gzip", "zip", "bz2"), or "infer" to detect it
+ *
+ * @return Decompressor producing the uncompressed data
+ */
+std::unique_ptr<stream_decompressor> make_stream_decompressor(host_span<char const> data,
+                                                              std::string const& compression);
+
 class HostDecompressor {
  public:
   virtual size_t Decompress(uint8_t* dstBytes,
@@ -56,6 +116,102 @@ class HostDecompressor {
   static std::unique_ptr<HostDecompressor> Create(int stream_type);
 };
 
+class HostCompressor {
+ public:
+  /**
+   * @brief Compresses a block
+   *
+   * @return Size of the compressed block, or zero if it does not fit in `dstLen` bytes
+   */
+  virtual size_t Compress(uint8_t* dstBytes,
+                          size_t dstLen,
+                          uint8_t const* srcBytes,
+                          size_t srcLen) = 0;
+  virtual ~HostCompressor() {}
+
+ public:
+  static std::unique_ptr<HostCompressor> Create(int stream_type);
+};
+
+/**
+ * @brief Decompresses a batch of independent blocks on the host
+ *
+ * Host counterpart of `gpuinflate()`/`gpu_unsnap()`: the source and destination pointers of the
+ * inputs refer to host memory. The blocks are distributed over a process-wide pool of worker
+ * threads, with the calling thread taking part in the work. Each output receives the number of
+ * decompressed bytes and a status of zero on success, or a non-zero status if the block could not
+ * be decompressed.
+ *
+ * @param stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param inputs Blocks to decompress
+ * @param outputs Per-block results, one for each input
+ */
+void host_decompress(int stream_type,
+                     host_span<gpu_inflate_input_s const> inputs,
+                     host_span<gpu_inflate_status_s> outputs);
+
+/**
+ * @brief Compresses a batch of independent blocks on the host
+ *
+ * Counterpart of `host_decompress()`. Each output receives the compressed size and a status of
+ * zero on success, or a non-zero status if the block could not be compressed into the space
+ * available at its destination.
+ *
+ * @param stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param inputs Blocks to compress
+ * @param outputs Per-block results, one for each input
+ */
+void host_compress(int stream_type,
+                   host_span<gpu_inflate_input_s const> inputs,
+                   host_span<gpu_inflate_status_s> outputs);
+
+/**
+ * @brief Decompresses a batch of blocks in device memory on the host
+ *
+ * Fallback for the compression methods without a GPU decoder, taking the same arguments as
+ * `gpu_unsnap()`: the inputs and outputs arrays, and the blocks they refer to, are in device
+ * memory. The blocks are copied to the host, decompressed with `host_decompress()`, and the
+ * results are copied back. Returns once the outputs are written.
+ *
+ * @param stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param inputs List of input argument structures, in device memory
+ * @param outputs List of output status structures, in device memory
+ * @param count Number of input/output structures
+ * @param stream CUDA stream to use
+ */
+void host_decompress_device(int stream_type,
+                            gpu_inflate_input_s* inputs,
+                            gpu_inflate_status_s* outputs,
+                            int count,
+                            rmm::cuda_stream_view stream);
+
+/**
+ * @brief Compresses a batch of blocks in device memory on the host
+ *
+ * Fallback for the compression methods without a GPU encoder, taking the same arguments as
+ * `gpu_snap()`. Returns once the outputs are written.
+ *
+ * @param stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param inputs List of input argument structures, in device memory
+ * @param outputs List of output status structures, in device memory
+ * @param count Number of input/output structures
+ * @param stream CUDA stream to use
+ */
+void host_compress_device(int stream_type,
+                          gpu_inflate_input_s* inputs,
+                          gpu_inflate_status_s* outputs,
+                          int count,
+                          rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns whether the readers decompress data on the host even when a GPU decoder exists
+ *
+ * Set with the `LIBCUDF_HOST_DECOMPRESSION` environment variable, to `ON` or `OFF` (the default).
+ * Decompressing on the host uses `host_decompress_device()`, which spreads the blocks over the
+ * host worker pool; this suits hosts with idle CPU cores or a GPU busy with other work.
+ */
+bool prefer_host_decompression();
+
 /**
  * @brief GZIP header flags
  * See https://tools.ietf.org/html/rfc1952
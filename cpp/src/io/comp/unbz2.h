@@ -77,6 +77,10 @@ For more information on these sources, see the manual.
 
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
 namespace cudf {
 namespace io {
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to
@@ -102,5 +106,55 @@ int32_t cpu_bz2_uncompress(const uint8_t *input,
                            size_t *dstlen,
                            uint64_t *block_start = nullptr);
 
+/**
+ * @brief Parallel decoder of bzip2 files
+ *
+ * The bzip2 blocks are independent once their bit-aligned start signatures are located. The input
+ * is scanned for block signatures up front, and batches of blocks are then decoded concurrently
+ * on the host worker pool, in waves of at most one block per thread. Signatures that occur
+ * by chance within compressed data are discarded, as only the blocks that follow one another from
+ * the stream header are kept. Files made of multiple concatenated bzip2 streams are decoded in
+ * full.
+ */
+class bz2_block_decoder {
+ public:
+  /**
+   * @brief Locates the blocks of a bzip2 file.
+   *
+   * @param input Compressed file; must outlive the decoder
+   * @param inlen Size of the compressed file
+   */
+  bz2_block_decoder(const uint8_t *input, size_t inlen);
+
+  /**
+   * @brief Decodes the next blocks of the file.
+   *
+   * @param max_blocks Maximum number of blocks to decode
+   * @param dst Vector to which the uncompressed data is appended
+   *
+   * @return BZ_OK if more blocks remain, BZ_STREAM_END once the whole file is decoded, or an error
+   */
+  int32_t decode(size_t max_blocks, std::vector<char> &dst);
+
+ private:
+  /**
+   * @brief Starts decoding the stream whose header is at the given byte offset, if any.
+   */
+  bool start_stream(size_t byte_pos);
+
+  /**
+   * @brief Decodes the next `count` candidate blocks concurrently, and appends the data of those
+   * that follow one another from the current position.
+   */
+  void decode_wave(size_t count, std::vector<char> &dst);
+
+  const uint8_t *input;
+  size_t inlen;
+  std::vector<uint64_t> candidates;  // Bit offsets of the block signatures
+  uint64_t cur_bit        = 0;       // Bit offset of the next block or end-of-stream signature
+  uint32_t block_size100k = 9;       // Block size of the current stream, in units of 100000 bytes
+  int32_t status          = BZ_OK;
+};
+
 }  // namespace io
 }  // namespace cudf
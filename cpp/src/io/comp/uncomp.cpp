@@ -17,6 +17,8 @@
 #include "io_uncomp.h"
 #include "unbz2.h"  // bz2 uncompress
 
+#include <io/utilities/host_parallel.hpp>
+
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -24,12 +26,21 @@
 
 #include <string.h>  // memset
 
+#include <functional>
+
+#include <lz4.h>
 #include <zlib.h>  // uncompress
+#include <zstd.h>
 
 using cudf::detail::host_span;
 
 namespace cudf {
 namespace io {
+// Number of bzip2 blocks decoded concurrently; blocks hold up to 900kB of run-length encoded data
+constexpr size_t bz2_blocks_per_batch = 64;
+// Amount of uncompressed data produced per batch of gzip members or zip entries inflated
+// concurrently when streaming; larger members are inflated on their own
+constexpr size_t inflate_batch_size = 64 << 20;
 
 #pragma pack(push, 1)
 
@@ -239,114 +250,187 @@ int cpu_inflate(uint8_t *uncomp_data, size_t *destLen, const uint8_t *comp_data,
 }
 
 /**
- * @Brief Uncompresses a raw DEFLATE stream to a char vector.
- * The vector will be grown to match the uncompressed size
- * Optimized for the case where the initial size is the uncompressed
- * size truncated to 32-bit, and grows the buffer in 1GB increments.
+ * @Brief Uncompresses consecutive gzip members, appending their data to a char vector.
+ *
+ * Decoding stops after the last member, or at data that is not a gzip member (such as padding).
  *
  * @param dst[out] Destination vector
- * @param comp_data[in] Raw compressed data
- * @param comp_len[in] Compressed data size
+ * @param raw[in] Start of the first member, including its header
+ * @param len[in] Size of the members, in bytes
  */
-int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t comp_len)
+int cpu_inflate_gzip_members(std::vector<char> &dst, const uint8_t *raw, size_t len)
 {
+  const uint8_t *const raw_end = raw + len;
+  gz_archive_s gz;
+  if (!ParseGZArchive(&gz, raw, len)) { return Z_DATA_ERROR; }
+
   int zerr;
   z_stream strm;
 
   memset(&strm, 0, sizeof(strm));
-  strm.next_in   = const_cast<Bytef *>(reinterpret_cast<Bytef const *>(comp_data));
-  strm.avail_in  = comp_len;
-  strm.total_in  = 0;
-  strm.next_out  = reinterpret_cast<uint8_t *>(dst.data());
-  strm.avail_out = dst.size();
-  strm.total_out = 0;
-  zerr           = inflateInit2(&strm, -15);  // -15 for raw data without GZIP headers
-  if (zerr != 0) {
-    dst.resize(0);
-    return zerr;
-  }
-  do {
-    if (strm.avail_out == 0) {
-      dst.resize(strm.total_out + (1 << 30));
-      strm.avail_out = dst.size() - strm.total_out;
-      strm.next_out  = reinterpret_cast<uint8_t *>(dst.data()) + strm.total_out;
+  strm.next_in  = const_cast<Bytef *>(reinterpret_cast<Bytef const *>(gz.comp_data));
+  strm.avail_in = raw_end - gz.comp_data;
+  zerr          = inflateInit2(&strm, -15);  // -15 for raw data without GZIP headers
+  if (zerr != 0) { return zerr; }
+  // The size of the last member is exact for single-member files
+  size_t out_len = dst.size();
+  dst.resize(out_len + std::max<size_t>(gz.isize, 4096));
+  while (true) {
+    if (out_len == dst.size()) {
+      dst.resize(out_len + std::min<size_t>(std::max<size_t>(out_len, 1 << 20), 1 << 30));
+    }
+    strm.next_out  = reinterpret_cast<uint8_t *>(dst.data()) + out_len;
+    strm.avail_out = dst.size() - out_len;
+    zerr           = inflate(&strm, Z_NO_FLUSH);
+    out_len        = dst.size() - strm.avail_out;
+    if (zerr == Z_STREAM_END) {
+      // Skip the CRC32 and ISIZE trailer of the member to get to the next one
+      const uint8_t *const member_end = strm.next_in + 8;
+      if (member_end > raw_end) {
+        zerr = Z_DATA_ERROR;
+        break;
+      }
+      if (!ParseGZArchive(&gz, member_end, raw_end - member_end)) {
+        zerr = Z_OK;
+        break;
+      }
+      inflateReset(&strm);
+      strm.next_in  = const_cast<Bytef *>(reinterpret_cast<Bytef const *>(gz.comp_data));
+      strm.avail_in = raw_end - gz.comp_data;
+    } else if (zerr != Z_OK) {
+      break;
     }
-    zerr = inflate(&strm, Z_SYNC_FLUSH);
-  } while ((zerr == Z_BUF_ERROR || zerr == Z_OK) && strm.avail_out == 0 &&
-           strm.total_out == dst.size());
-  dst.resize(strm.total_out);
+  }
+  dst.resize(out_len);
   inflateEnd(&strm);
-  return (zerr == Z_STREAM_END) ? Z_OK : zerr;
+  return zerr;
 }
 
 /**
- * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
+ * @Brief Uncompresses consecutive Zstandard frames to a char vector.
  *
- * The result is allocated and stored in a vector.
- * If the function call fails, the output vector is empty.
+ * The vector is grown as needed, starting from its initial size.
  *
- * @param src[in] Pointer to the compressed data in system memory
- * @param src_size[in] The size of the compressed data, in bytes
- * @param stream_type[in] Type of compression of the input data
+ * @param dst[out] Destination vector
+ * @param comp_data[in] Compressed data
+ * @param comp_len[in] Compressed data size
  *
- * @return Vector containing the uncompressed output
+ * @returns true if successful
  */
-std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int stream_type)
+bool cpu_zstd_decompress_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t comp_len)
 {
-  const uint8_t *raw       = static_cast<const uint8_t *>(src);
+  std::unique_ptr<ZSTD_DStream, size_t (*)(ZSTD_DStream *)> dstrm(ZSTD_createDStream(),
+                                                                  ZSTD_freeDStream);
+  if (dstrm == nullptr) { return false; }
+  ZSTD_inBuffer in{comp_data, comp_len, 0};
+  size_t out_len = 0;
+  size_t ret     = 0;
+  do {
+    if (out_len == dst.size()) {
+      dst.resize(out_len + std::min<size_t>(std::max<size_t>(out_len, 1 << 20), 1 << 30));
+    }
+    ZSTD_outBuffer out{dst.data(), dst.size(), out_len};
+    ret = ZSTD_decompressStream(dstrm.get(), &out, &in);
+    if (ZSTD_isError(ret)) { return false; }
+    out_len = out.pos;
+    // A non-zero return value with a full output buffer means more output is pending
+  } while (in.pos < in.size || (ret != 0 && out_len == dst.size()));
+  dst.resize(out_len);
+  return ret == 0;
+}
+
+/**
+ * @Brief Location and format of the compressed data within a gzip/zip/bzip2 file
+ */
+struct compressed_stream_s {
+  int stream_type          = IO_UNCOMP_STREAM_TYPE_INFER;
   const uint8_t *comp_data = nullptr;
   size_t comp_len          = 0;
-  size_t uncomp_len        = 0;
+  size_t uncomp_len        = 0;  // Zero if unknown
+};
 
-  CUDF_EXPECTS(src != nullptr, "Decompression: Source cannot be nullptr");
-  CUDF_EXPECTS(src_size != 0, "Decompression: Source size cannot be 0");
+/**
+ * @Brief Finds the files of a zip archive stored in system memory.
+ *
+ * Only files of non-zero size compressed with DEFLATE are returned.
+ *
+ * @param raw[in] Pointer to the archive data in system memory
+ * @param src_size[in] The size of the archive, in bytes
+ *
+ * @returns Raw DEFLATE streams (IO_UNCOMP_STREAM_TYPE_INFLATE) of the files, in directory order
+ */
+std::vector<compressed_stream_s> find_zip_entries(const uint8_t *raw, size_t src_size)
+{
+  std::vector<compressed_stream_s> entries;
+  zip_archive_s za;
+  if (!OpenZipArchive(&za, raw, src_size)) { return entries; }
+
+  size_t cdfh_ofs = 0;
+  for (int i = 0; i < za.eocd->num_entries; i++) {
+    const zip_cdfh_s *cdfh =
+      reinterpret_cast<const zip_cdfh_s *>(reinterpret_cast<const uint8_t *>(za.cdfh) + cdfh_ofs);
+    int cdfh_len = sizeof(zip_cdfh_s) + cdfh->fname_len + cdfh->extra_len + cdfh->comment_len;
+    if (cdfh_ofs + cdfh_len > za.eocd->cdir_size || cdfh->sig != 0x02014b50) {
+      // Bad cdir
+      break;
+    }
+    // For now, only accept with non-zero file sizes and DEFLATE
+    if (cdfh->comp_method == 8 && cdfh->comp_size > 0 && cdfh->uncomp_size > 0) {
+      size_t lfh_ofs       = cdfh->hdr_ofs;
+      const zip_lfh_s *lfh = reinterpret_cast<const zip_lfh_s *>(raw + lfh_ofs);
+      if (lfh_ofs + sizeof(zip_lfh_s) <= src_size && lfh->sig == 0x04034b50 &&
+          lfh_ofs + sizeof(zip_lfh_s) + lfh->fname_len + lfh->extra_len <= src_size) {
+        if (lfh->comp_method == 8 && lfh->comp_size > 0 && lfh->uncomp_size > 0) {
+          size_t file_start = lfh_ofs + sizeof(zip_lfh_s) + lfh->fname_len + lfh->extra_len;
+          size_t file_end   = file_start + lfh->comp_size;
+          if (file_end <= src_size) {
+            compressed_stream_s entry;
+            entry.stream_type = IO_UNCOMP_STREAM_TYPE_INFLATE;
+            entry.comp_data   = raw + file_start;
+            entry.comp_len    = lfh->comp_size;
+            entry.uncomp_len  = lfh->uncomp_size;
+            entries.push_back(entry);
+          }
+        }
+      }
+    }
+    cdfh_ofs += cdfh_len;
+  }
+  return entries;
+}
+
+/**
+ * @Brief Finds the compressed data within a gzip/zip/bzip2 file stored in system memory.
+ *
+ * @param raw[in] Pointer to the file data in system memory
+ * @param src_size[in] The size of the file, in bytes
+ * @param stream_type[in] Type of compression of the input data, or INFER
+ *
+ * @returns Description of the compressed stream; `comp_data` is nullptr if not found
+ */
+compressed_stream_s find_compressed_stream(const uint8_t *raw, size_t src_size, int stream_type)
+{
+  compressed_stream_s strm;
 
   switch (stream_type) {
     case IO_UNCOMP_STREAM_TYPE_INFER:
     case IO_UNCOMP_STREAM_TYPE_GZIP: {
       gz_archive_s gz;
       if (ParseGZArchive(&gz, raw, src_size)) {
-        stream_type = IO_UNCOMP_STREAM_TYPE_GZIP;
-        comp_data   = gz.comp_data;
-        comp_len    = gz.comp_len;
-        uncomp_len  = gz.isize;
+        stream_type     = IO_UNCOMP_STREAM_TYPE_GZIP;
+        strm.comp_data  = gz.comp_data;
+        strm.comp_len   = gz.comp_len;
+        strm.uncomp_len = gz.isize;
       }
       if (stream_type != IO_UNCOMP_STREAM_TYPE_INFER) break;  // Fall through for INFER
     }
     case IO_UNCOMP_STREAM_TYPE_ZIP: {
-      zip_archive_s za;
-      if (OpenZipArchive(&za, raw, src_size)) {
-        size_t cdfh_ofs = 0;
-        for (int i = 0; i < za.eocd->num_entries; i++) {
-          const zip_cdfh_s *cdfh = reinterpret_cast<const zip_cdfh_s *>(
-            reinterpret_cast<const uint8_t *>(za.cdfh) + cdfh_ofs);
-          int cdfh_len = sizeof(zip_cdfh_s) + cdfh->fname_len + cdfh->extra_len + cdfh->comment_len;
-          if (cdfh_ofs + cdfh_len > za.eocd->cdir_size || cdfh->sig != 0x02014b50) {
-            // Bad cdir
-            break;
-          }
-          // For now, only accept with non-zero file sizes and DEFLATE
-          if (cdfh->comp_method == 8 && cdfh->comp_size > 0 && cdfh->uncomp_size > 0) {
-            size_t lfh_ofs       = cdfh->hdr_ofs;
-            const zip_lfh_s *lfh = reinterpret_cast<const zip_lfh_s *>(raw + lfh_ofs);
-            if (lfh_ofs + sizeof(zip_lfh_s) <= src_size && lfh->sig == 0x04034b50 &&
-                lfh_ofs + sizeof(zip_lfh_s) + lfh->fname_len + lfh->extra_len <= src_size) {
-              if (lfh->comp_method == 8 && lfh->comp_size > 0 && lfh->uncomp_size > 0) {
-                size_t file_start = lfh_ofs + sizeof(zip_lfh_s) + lfh->fname_len + lfh->extra_len;
-                size_t file_end   = file_start + lfh->comp_size;
-                if (file_end <= src_size) {
-                  // Pick the first valid file of non-zero size (only 1 file expected in archive)
-                  stream_type = IO_UNCOMP_STREAM_TYPE_ZIP;
-                  comp_data   = raw + file_start;
-                  comp_len    = lfh->comp_size;
-                  uncomp_len  = lfh->uncomp_size;
-                  break;
-                }
-              }
-            }
-          }
-          cdfh_ofs += cdfh_len;
-        }
+      auto const entries = find_zip_entries(raw, src_size);
+      if (!entries.empty()) {
+        stream_type     = IO_UNCOMP_STREAM_TYPE_ZIP;
+        strm.comp_data  = entries[0].comp_data;
+        strm.comp_len   = entries[0].comp_len;
+        strm.uncomp_len = entries[0].uncomp_len;
       }
     }
       if (stream_type != IO_UNCOMP_STREAM_TYPE_INFER) break;  // Fall through for INFER
@@ -356,17 +440,172 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
         // Check for BZIP2 file signature "BZh1" to "BZh9"
         if (fhdr->sig[0] == 'B' && fhdr->sig[1] == 'Z' && fhdr->sig[2] == 'h' &&
             fhdr->blksz >= '1' && fhdr->blksz <= '9') {
-          stream_type = IO_UNCOMP_STREAM_TYPE_BZIP2;
-          comp_data   = raw;
-          comp_len    = src_size;
-          uncomp_len  = 0;
+          stream_type     = IO_UNCOMP_STREAM_TYPE_BZIP2;
+          strm.comp_data  = raw;
+          strm.comp_len   = src_size;
+          strm.uncomp_len = 0;
         }
       }
       if (stream_type != IO_UNCOMP_STREAM_TYPE_INFER) break;  // Fall through for INFER
+    case IO_UNCOMP_STREAM_TYPE_ZSTD:
+      // Check for the magic number of a Zstandard frame
+      if (src_size > 4 && raw[0] == 0x28 && raw[1] == 0xb5 && raw[2] == 0x2f && raw[3] == 0xfd) {
+        auto const frame_size = ZSTD_getFrameContentSize(raw, src_size);
+        stream_type           = IO_UNCOMP_STREAM_TYPE_ZSTD;
+        strm.comp_data        = raw;
+        strm.comp_len         = src_size;
+        // Size of the first frame, if recorded; only used as an initial estimate
+        strm.uncomp_len = (frame_size < ZSTD_CONTENTSIZE_ERROR) ? frame_size : 0;
+      }
+      if (stream_type != IO_UNCOMP_STREAM_TYPE_INFER) break;  // Fall through for INFER
     default:
       // Unsupported format
       break;
   }
+  strm.stream_type = stream_type;
+  return strm;
+}
+
+/**
+ * @Brief Returns the size of a BGZF member, or zero if the gzip member is not a BGZF block.
+ *
+ * BGZF files (as produced by bgzip) store the total size of each member, minus one, in a "BC"
+ * extra subfield, which allows locating the members without decompressing them.
+ */
+size_t bgzf_member_size(gz_archive_s const &gz)
+{
+  size_t pos = 0;
+  while (pos + 4 <= gz.xlen) {
+    const uint8_t *subfield = gz.fxtra + pos;
+    size_t const sub_len    = subfield[2] | (subfield[3] << 8);
+    if (subfield[0] == 'B' && subfield[1] == 'C' && sub_len == 2 && pos + 6 <= gz.xlen) {
+      return (subfield[4] | (subfield[5] << 8)) + 1;
+    }
+    pos += 4 + sub_len;
+  }
+  return 0;
+}
+
+/**
+ * @Brief Splits a gzip/zip/bzip2 file stored in system memory into independently decodable parts.
+ *
+ * Zip files are split into their files, and BGZF files into their gzip members, as raw DEFLATE
+ * streams of known uncompressed size (IO_UNCOMP_STREAM_TYPE_INFLATE). The boundaries of other
+ * gzip members are only known once they are decompressed, so the members that follow the last
+ * BGZF member are returned as a single IO_UNCOMP_STREAM_TYPE_GZIP part. Bzip2 files are returned
+ * as a single part.
+ *
+ * @param raw[in] Pointer to the file data in system memory
+ * @param src_size[in] The size of the file, in bytes
+ * @param stream_type[in] Type of compression of the input data, or INFER
+ *
+ * @returns Parts of the file, in order; empty if the format is not supported
+ */
+std::vector<compressed_stream_s> find_compressed_members(const uint8_t *raw,
+                                                         size_t src_size,
+                                                         int stream_type)
+{
+  auto const strm = find_compressed_stream(raw, src_size, stream_type);
+  if (strm.comp_data == nullptr) { return {}; }
+  if (strm.stream_type == IO_UNCOMP_STREAM_TYPE_ZIP) { return find_zip_entries(raw, src_size); }
+  if (strm.stream_type != IO_UNCOMP_STREAM_TYPE_GZIP) { return {strm}; }
+
+  std::vector<compressed_stream_s> members;
+  size_t pos = 0;
+  gz_archive_s gz;
+  while (pos < src_size && ParseGZArchive(&gz, raw + pos, src_size - pos)) {
+    auto const member_size = bgzf_member_size(gz);
+    if (member_size == 0 || member_size > src_size - pos ||
+        !ParseGZArchive(&gz, raw + pos, member_size)) {
+      compressed_stream_s rest;
+      rest.stream_type = IO_UNCOMP_STREAM_TYPE_GZIP;
+      rest.comp_data   = raw + pos;
+      rest.comp_len    = src_size - pos;
+      members.push_back(rest);
+      break;
+    }
+    // Skip empty members, such as the end-of-file marker of BGZF files
+    if (gz.isize != 0) {
+      compressed_stream_s member;
+      member.stream_type = IO_UNCOMP_STREAM_TYPE_INFLATE;
+      member.comp_data   = gz.comp_data;
+      member.comp_len    = gz.comp_len;
+      member.uncomp_len  = gz.isize;
+      members.push_back(member);
+    }
+    pos += member_size;
+  }
+  return members;
+}
+
+/**
+ * @Brief Uncompresses a raw DEFLATE part of known uncompressed size.
+ *
+ * @param member[in] Part returned by `find_compressed_members()`
+ * @param dst[out] Destination buffer of `member.uncomp_len` bytes
+ */
+void inflate_member(compressed_stream_s const &member, char *dst)
+{
+  size_t uncomp_len = member.uncomp_len;
+  auto const zerr =
+    cpu_inflate(reinterpret_cast<uint8_t *>(dst), &uncomp_len, member.comp_data, member.comp_len);
+  CUDF_EXPECTS(zerr == Z_OK && uncomp_len == member.uncomp_len, "Decompression: error in stream");
+}
+
+/**
+ * @Brief Uncompresses the parts of a gzip or zip file and concatenates their data.
+ *
+ * Parts of known uncompressed size are inflated in parallel, directly into the output.
+ *
+ * @param members[in] Parts returned by `find_compressed_members()`
+ *
+ * @return Vector containing the uncompressed output
+ */
+std::vector<char> inflate_members(std::vector<compressed_stream_s> const &members)
+{
+  std::vector<size_t> offsets(members.size() + 1, 0);
+  for (size_t i = 0; i < members.size(); ++i) {
+    auto const is_inflate = (members[i].stream_type == IO_UNCOMP_STREAM_TYPE_INFLATE);
+    offsets[i + 1]        = offsets[i] + (is_inflate ? members[i].uncomp_len : 0);
+  }
+  std::vector<char> dst(offsets.back());
+  host_parallel_for(members.size(), [&](size_t i) {
+    if (members[i].stream_type == IO_UNCOMP_STREAM_TYPE_INFLATE) {
+      inflate_member(members[i], dst.data() + offsets[i]);
+    }
+  });
+  // Only the last part can be a sequence of gzip members of unknown size
+  if (!members.empty() && members.back().stream_type == IO_UNCOMP_STREAM_TYPE_GZIP) {
+    CUDF_EXPECTS(
+      cpu_inflate_gzip_members(dst, members.back().comp_data, members.back().comp_len) == Z_OK,
+      "Decompression: error in stream");
+  }
+  return dst;
+}
+
+/**
+ * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
+ *
+ * The result is allocated and stored in a vector.
+ * If the function call fails, the output vector is empty.
+ *
+ * @param src[in] Pointer to the compressed data in system memory
+ * @param src_size[in] The size of the compressed data, in bytes
+ * @param stream_type[in] Type of compression of the input data
+ *
+ * @return Vector containing the uncompressed output
+ */
+std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int stream_type)
+{
+  CUDF_EXPECTS(src != nullptr, "Decompression: Source cannot be nullptr");
+  CUDF_EXPECTS(src_size != 0, "Decompression: Source size cannot be 0");
+
+  auto const strm =
+    find_compressed_stream(static_cast<const uint8_t *>(src), src_size, stream_type);
+  const uint8_t *comp_data = strm.comp_data;
+  size_t comp_len          = strm.comp_len;
+  size_t uncomp_len        = strm.uncomp_len;
+  stream_type              = strm.stream_type;
   CUDF_EXPECTS(comp_data != nullptr, "Unsupported compressed stream type");
   CUDF_EXPECTS(comp_len > 0, "Unsupported compressed stream type");
 
@@ -376,34 +615,25 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
   }
 
   if (stream_type == IO_UNCOMP_STREAM_TYPE_GZIP || stream_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
-    // INFLATE
-    std::vector<char> dst(uncomp_len);
-    CUDF_EXPECTS(cpu_inflate_vector(dst, comp_data, comp_len) == 0,
-                 "Decompression: error in stream");
-    return dst;
+    // INFLATE all gzip members or zip files
+    return inflate_members(
+      find_compressed_members(static_cast<const uint8_t *>(src), src_size, stream_type));
   }
   if (stream_type == IO_UNCOMP_STREAM_TYPE_BZIP2) {
-    size_t src_ofs = 0;
-    size_t dst_ofs = 0;
-    int bz_err     = 0;
-    std::vector<char> dst(uncomp_len);
+    std::vector<char> dst;
+    dst.reserve(uncomp_len);
+    bz2_block_decoder decoder(comp_data, comp_len);
+    int bz_err = 0;
     do {
-      size_t dst_len = uncomp_len - dst_ofs;
-      bz_err         = cpu_bz2_uncompress(
-        comp_data, comp_len, reinterpret_cast<uint8_t *>(dst.data()) + dst_ofs, &dst_len, &src_ofs);
-      if (bz_err == BZ_OUTBUFF_FULL) {
-        // TBD: We could infer the compression ratio based on produced/consumed byte counts
-        // in order to minimize realloc events and over-allocation
-        dst_ofs = dst_len;
-        dst_len = uncomp_len + (uncomp_len / 2);
-        dst.resize(dst_len);
-        uncomp_len = dst_len;
-      } else if (bz_err == 0) {
-        uncomp_len = dst_len;
-        dst.resize(uncomp_len);
-      }
-    } while (bz_err == BZ_OUTBUFF_FULL);
-    CUDF_EXPECTS(bz_err == 0, "Decompression: error in stream");
+      bz_err = decoder.decode(bz2_blocks_per_batch, dst);
+    } while (bz_err == BZ_OK);
+    CUDF_EXPECTS(bz_err == BZ_STREAM_END, "Decompression: error in stream");
+    return dst;
+  }
+  if (stream_type == IO_UNCOMP_STREAM_TYPE_ZSTD) {
+    std::vector<char> dst(uncomp_len);
+    CUDF_EXPECTS(cpu_zstd_decompress_vector(dst, comp_data, comp_len),
+                 "Decompression: error in stream");
     return dst;
   }
 
@@ -422,17 +652,260 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
 std::vector<char> get_uncompressed_data(host_span<char const> const data,
                                         std::string const &compression)
 {
-  int comp_type = IO_UNCOMP_STREAM_TYPE_INFER;
-  if (compression == "gzip")
-    comp_type = IO_UNCOMP_STREAM_TYPE_GZIP;
-  else if (compression == "zip")
-    comp_type = IO_UNCOMP_STREAM_TYPE_ZIP;
-  else if (compression == "bz2")
-    comp_type = IO_UNCOMP_STREAM_TYPE_BZIP2;
-  else if (compression == "xz")
-    comp_type = IO_UNCOMP_STREAM_TYPE_XZ;
-
-  return io_uncompress_single_h2d(data.data(), data.size(), comp_type);
+  return io_uncompress_single_h2d(data.data(), data.size(), to_stream_type(compression));
+}
+
+/**
+ * @Brief Streaming decompressor for raw DEFLATE data, or for consecutive gzip members
+ */
+class stream_decompressor_inflate : public stream_decompressor {
+ public:
+  stream_decompressor_inflate(const uint8_t *comp_data, size_t comp_len, bool is_gzip)
+    : input_end(comp_data + comp_len), is_gzip(is_gzip)
+  {
+    if (is_gzip) {
+      gz_archive_s gz;
+      CUDF_EXPECTS(ParseGZArchive(&gz, comp_data, comp_len), "Decompression: error in stream");
+      comp_data = gz.comp_data;
+    }
+    memset(&strm, 0, sizeof(strm));
+    strm.next_in  = const_cast<Bytef *>(reinterpret_cast<Bytef const *>(comp_data));
+    strm.avail_in = input_end - comp_data;
+    CUDF_EXPECTS(inflateInit2(&strm, -15) == Z_OK,  // -15 for raw data without GZIP headers
+                 "Decompression: failed to initialize inflate");
+  }
+  ~stream_decompressor_inflate() override { inflateEnd(&strm); }
+
+  size_t read(host_span<char> dst) override
+  {
+    strm.next_out  = reinterpret_cast<Bytef *>(dst.data());
+    strm.avail_out = dst.size();
+    while (!is_eof && strm.avail_out != 0) {
+      auto const zerr = inflate(&strm, Z_NO_FLUSH);
+      if (zerr == Z_STREAM_END) {
+        is_eof = !(is_gzip && next_gzip_member());
+      } else {
+        CUDF_EXPECTS(zerr == Z_OK, "Decompression: error in stream");
+      }
+    }
+    return dst.size() - strm.avail_out;
+  }
+
+  bool eof() const override { return is_eof; }
+
+ protected:
+  /**
+   * @Brief Restarts decompression at the gzip member following the current one, if any.
+   */
+  bool next_gzip_member()
+  {
+    // Skip the CRC32 and ISIZE trailer of the member
+    const uint8_t *const member_end = strm.next_in + 8;
+    CUDF_EXPECTS(member_end <= input_end, "Decompression: error in stream");
+    gz_archive_s gz;
+    if (!ParseGZArchive(&gz, member_end, input_end - member_end)) { return false; }
+    inflateReset(&strm);
+    strm.next_in  = const_cast<Bytef *>(reinterpret_cast<Bytef const *>(gz.comp_data));
+    strm.avail_in = input_end - gz.comp_data;
+    return true;
+  }
+
+  z_stream strm;
+  const uint8_t *const input_end;
+  bool const is_gzip;
+  bool is_eof = false;
+};
+
+/**
+ * @Brief Streaming decompressor for the parts of a gzip or zip file
+ *
+ * Consecutive parts of known size (BGZF members, zip files) are inflated in parallel, a batch of
+ * up to `inflate_batch_size` bytes at a time, into a staging buffer. Larger parts and gzip members
+ * of unknown size are streamed on their own.
+ */
+class stream_decompressor_members : public stream_decompressor {
+ public:
+  explicit stream_decompressor_members(std::vector<compressed_stream_s> &&members)
+    : members(std::move(members))
+  {
+  }
+
+  size_t read(host_span<char> dst) override
+  {
+    size_t bytes_read = 0;
+    while (bytes_read < dst.size()) {
+      if (current != nullptr) {
+        bytes_read += current->read(dst.subspan(bytes_read, dst.size() - bytes_read));
+        if (current->eof()) { current.reset(); }
+        continue;
+      }
+      if (staging_pos == staging.size()) {
+        if (next_member == members.size()) { break; }
+        decompress_batch();
+        continue;
+      }
+      auto const len = std::min(dst.size() - bytes_read, staging.size() - staging_pos);
+      memcpy(dst.data() + bytes_read, staging.data() + staging_pos, len);
+      staging_pos += len;
+      bytes_read += len;
+    }
+    return bytes_read;
+  }
+
+  bool eof() const override
+  {
+    return current == nullptr && staging_pos == staging.size() && next_member == members.size();
+  }
+
+ protected:
+  void decompress_batch()
+  {
+    staging.clear();
+    staging_pos       = 0;
+    auto const &first = members[next_member];
+    if (first.stream_type != IO_UNCOMP_STREAM_TYPE_INFLATE ||
+        first.uncomp_len > inflate_batch_size) {
+      current = std::make_unique<stream_decompressor_inflate>(
+        first.comp_data, first.comp_len, first.stream_type == IO_UNCOMP_STREAM_TYPE_GZIP);
+      ++next_member;
+      return;
+    }
+    std::vector<size_t> offsets;
+    size_t batch_end = next_member;
+    size_t total_len = 0;
+    while (batch_end < members.size() &&
+           members[batch_end].stream_type == IO_UNCOMP_STREAM_TYPE_INFLATE &&
+           total_len + members[batch_end].uncomp_len <= inflate_batch_size) {
+      offsets.push_back(total_len);
+      total_len += members[batch_end].uncomp_len;
+      ++batch_end;
+    }
+    staging.resize(total_len);
+    host_parallel_for(offsets.size(), [&](size_t i) {
+      inflate_member(members[next_member + i], staging.data() + offsets[i]);
+    });
+    next_member = batch_end;
+  }
+
+  std::vector<compressed_stream_s> const members;
+  size_t next_member = 0;
+  std::unique_ptr<stream_decompressor> current;  // Part that is streamed on its own
+  std::vector<char> staging;
+  size_t staging_pos = 0;
+};
+
+/**
+ * @Brief Streaming decompressor for bzip2 files
+ *
+ * The data is decompressed a batch of bzip2 blocks at a time into a staging buffer.
+ */
+class stream_decompressor_bz2 : public stream_decompressor {
+ public:
+  stream_decompressor_bz2(const uint8_t *comp_data, size_t comp_len) : decoder(comp_data, comp_len)
+  {
+  }
+
+  size_t read(host_span<char> dst) override
+  {
+    size_t bytes_read = 0;
+    while (bytes_read < dst.size()) {
+      if (staging_pos == staging.size()) {
+        if (is_last_batch) { break; }
+        decompress_batch();
+        continue;
+      }
+      auto const len = std::min(dst.size() - bytes_read, staging.size() - staging_pos);
+      memcpy(dst.data() + bytes_read, staging.data() + staging_pos, len);
+      staging_pos += len;
+      bytes_read += len;
+    }
+    return bytes_read;
+  }
+
+  bool eof() const override { return is_last_batch && staging_pos == staging.size(); }
+
+ protected:
+  void decompress_batch()
+  {
+    staging.clear();
+    staging_pos       = 0;
+    auto const bz_err = decoder.decode(bz2_blocks_per_batch, staging);
+    CUDF_EXPECTS(bz_err == BZ_OK || bz_err == BZ_STREAM_END, "Decompression: error in stream");
+    is_last_batch = (bz_err == BZ_STREAM_END);
+  }
+
+  bz2_block_decoder decoder;
+  std::vector<char> staging;
+  size_t staging_pos = 0;
+  bool is_last_batch = false;
+};
+
+/**
+ * @Brief Streaming decompressor for Zstandard files
+ */
+class stream_decompressor_zstd : public stream_decompressor {
+ public:
+  stream_decompressor_zstd(const uint8_t *comp_data, size_t comp_len)
+    : dstrm(ZSTD_createDStream(), ZSTD_freeDStream), in{comp_data, comp_len, 0}
+  {
+    CUDF_EXPECTS(dstrm != nullptr, "Decompression: failed to initialize zstd");
+  }
+
+  size_t read(host_span<char> dst) override
+  {
+    ZSTD_outBuffer out{dst.data(), dst.size(), 0};
+    while (!is_eof && out.pos < out.size) {
+      auto const in_pos  = in.pos;
+      auto const out_pos = out.pos;
+      auto const ret     = ZSTD_decompressStream(dstrm.get(), &out, &in);
+      CUDF_EXPECTS(!ZSTD_isError(ret), "Decompression: error in stream");
+      if (ret == 0 && in.pos == in.size) {
+        is_eof = true;
+      } else {
+        CUDF_EXPECTS(in.pos != in_pos || out.pos != out_pos, "Decompression: error in stream");
+      }
+    }
+    return out.pos;
+  }
+
+  bool eof() const override { return is_eof; }
+
+ protected:
+  std::unique_ptr<ZSTD_DStream, size_t (*)(ZSTD_DStream *)> dstrm;
+  ZSTD_inBuffer in;
+  bool is_eof = false;
+};
+
+int to_stream_type(std::string const &compression)
+{
+  if (compression == "gzip") return IO_UNCOMP_STREAM_TYPE_GZIP;
+  if (compression == "zip") return IO_UNCOMP_STREAM_TYPE_ZIP;
+  if (compression == "bz2") return IO_UNCOMP_STREAM_TYPE_BZIP2;
+  if (compression == "xz") return IO_UNCOMP_STREAM_TYPE_XZ;
+  if (compression == "zstd") return IO_UNCOMP_STREAM_TYPE_ZSTD;
+  return IO_UNCOMP_STREAM_TYPE_INFER;
+}
+
+std::unique_ptr<stream_decompressor> make_stream_decompressor(host_span<char const> data,
+                                                              std::string const &compression)
+{
+  CUDF_EXPECTS(data.data() != nullptr, "Decompression: Source cannot be nullptr");
+  CUDF_EXPECTS(data.size() != 0, "Decompression: Source size cannot be 0");
+
+  auto members = find_compressed_members(
+    reinterpret_cast<const uint8_t *>(data.data()), data.size(), to_stream_type(compression));
+  CUDF_EXPECTS(!members.empty(), "Unsupported compressed stream type");
+
+  switch (members[0].stream_type) {
+    case IO_UNCOMP_STREAM_TYPE_GZIP:
+    case IO_UNCOMP_STREAM_TYPE_INFLATE:
+      return std::make_unique<stream_decompressor_members>(std::move(members));
+    case IO_UNCOMP_STREAM_TYPE_BZIP2:
+      return std::make_unique<stream_decompressor_bz2>(members[0].comp_data, members[0].comp_len);
+    case IO_UNCOMP_STREAM_TYPE_ZSTD:
+      return std::make_unique<stream_decompressor_zstd>(members[0].comp_data, members[0].comp_len);
+  }
+  CUDF_FAIL("Unsupported compressed stream type");
 }
 
 /**
@@ -525,10 +998,18 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
         }
         if (offset - 1u >= dst_pos || blen > bytes_left) break;
         bytes_left -= blen;
-        do {
-          dstBytes[dst_pos] = dstBytes[dst_pos - offset];
-          dst_pos++;
-        } while (--blen);
+        // Copy the match with non-overlapping memcpy calls; when the match overlaps its source,
+        // the bytes copied so far repeat the pattern, so each copy can be twice as long
+        uint8_t *out      = dstBytes + dst_pos;
+        uint8_t const *in = out - offset;
+        dst_pos += blen;
+        while (static_cast<uint32_t>(out - in) < blen) {
+          uint32_t const chunk = static_cast<uint32_t>(out - in);
+          memcpy(out, in, chunk);
+          out += chunk;
+          blen -= chunk;
+        }
+        memcpy(out, in, blen);
       } else {
         // xxxxxx00: literal
         blen >>= 2;
@@ -557,6 +1038,108 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/**
+ * @Brief ZSTD host decompressor class
+ */
+class HostDecompressor_ZSTD : public HostDecompressor {
+ public:
+  HostDecompressor_ZSTD() : m_dctx(ZSTD_createDCtx())
+  {
+    CUDF_EXPECTS(m_dctx != nullptr, "Failed to create ZSTD decompression context");
+  }
+  ~HostDecompressor_ZSTD() override { ZSTD_freeDCtx(m_dctx); }
+
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    auto const uncomp_len = ZSTD_decompressDCtx(m_dctx, dstBytes, dstLen, srcBytes, srcLen);
+    return ZSTD_isError(uncomp_len) ? 0 : uncomp_len;
+  }
+
+ protected:
+  ZSTD_DCtx *const m_dctx;
+};
+
+/**
+ * @Brief LZ4 host decompressor class
+ *
+ * Decodes raw LZ4 blocks. With Hadoop framing, the input is first parsed as written by Hadoop's
+ * Lz4Codec: a sequence of blocks, each starting with its big-endian uncompressed size and holding
+ * one or more LZ4 chunks preceded by their big-endian compressed size. Inputs that do not parse
+ * as such are decoded as a raw block.
+ */
+class HostDecompressor_LZ4 : public HostDecompressor {
+ public:
+  HostDecompressor_LZ4(bool hadoop_framing_) : hadoop_framing(hadoop_framing_) {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    if (hadoop_framing) {
+      auto const uncomp_len = DecompressHadoop(dstBytes, dstLen, srcBytes, srcLen);
+      if (uncomp_len != 0) { return uncomp_len; }
+    }
+    return DecompressBlock(dstBytes, dstLen, srcBytes, srcLen);
+  }
+
+ protected:
+  static size_t DecompressBlock(uint8_t *dstBytes,
+                                size_t dstLen,
+                                const uint8_t *srcBytes,
+                                size_t srcLen)
+  {
+    if (srcLen > LZ4_MAX_INPUT_SIZE) { return 0; }
+    auto const uncomp_len =
+      LZ4_decompress_safe(reinterpret_cast<const char *>(srcBytes),
+                          reinterpret_cast<char *>(dstBytes),
+                          static_cast<int>(srcLen),
+                          static_cast<int>(std::min<size_t>(dstLen, LZ4_MAX_INPUT_SIZE)));
+    return (uncomp_len > 0) ? uncomp_len : 0;
+  }
+
+  static size_t DecompressHadoop(uint8_t *dstBytes,
+                                 size_t dstLen,
+                                 const uint8_t *srcBytes,
+                                 size_t srcLen)
+  {
+    auto load_be32 = [](const uint8_t *p) {
+      return (static_cast<uint32_t>(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+    };
+    size_t uncomp_len = 0;
+    while (srcLen >= 4) {
+      // Each block records its uncompressed size, and holds one or more LZ4 chunks that each
+      // record their compressed size
+      uint32_t const block_uncomp_len = load_be32(srcBytes);
+      srcBytes += 4;
+      srcLen -= 4;
+      if (block_uncomp_len > dstLen - uncomp_len) { return 0; }
+      size_t block_len = 0;
+      while (block_len < block_uncomp_len) {
+        if (srcLen < 4) { return 0; }
+        uint32_t const chunk_comp_len = load_be32(srcBytes);
+        srcBytes += 4;
+        srcLen -= 4;
+        if (chunk_comp_len > srcLen) { return 0; }
+        auto const chunk_len = DecompressBlock(dstBytes + uncomp_len + block_len,
+                                               block_uncomp_len - block_len,
+                                               srcBytes,
+                                               chunk_comp_len);
+        if (chunk_len == 0) { return 0; }
+        block_len += chunk_len;
+        srcBytes += chunk_comp_len;
+        srcLen -= chunk_comp_len;
+      }
+      uncomp_len += block_uncomp_len;
+    }
+    return (srcLen == 0) ? uncomp_len : 0;
+  }
+
+  const bool hadoop_framing;
+};
+
 /**
  * @Brief CPU decompression class
  *
@@ -570,9 +1153,33 @@ std::unique_ptr<HostDecompressor> HostDecompressor::Create(int stream_type)
     case IO_UNCOMP_STREAM_TYPE_GZIP: return std::make_unique<HostDecompressor_ZLIB>(true);
     case IO_UNCOMP_STREAM_TYPE_INFLATE: return std::make_unique<HostDecompressor_ZLIB>(false);
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: return std::make_unique<HostDecompressor_SNAPPY>();
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: return std::make_unique<HostDecompressor_ZSTD>();
+    case IO_UNCOMP_STREAM_TYPE_LZ4: return std::make_unique<HostDecompressor_LZ4>(false);
+    case IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP: return std::make_unique<HostDecompressor_LZ4>(true);
   }
   CUDF_FAIL("Unsupported compression type");
 }
 
+void host_decompress(int stream_type,
+                     host_span<gpu_inflate_input_s const> inputs,
+                     host_span<gpu_inflate_status_s> outputs)
+{
+  CUDF_EXPECTS(inputs.size() == outputs.size(), "Mismatched number of inputs and outputs");
+  // Validates the stream type before any work is queued
+  HostDecompressor::Create(stream_type);
+
+  host_parallel_for(inputs.size(), [&](size_t i) {
+    auto const &in    = inputs[i];
+    auto &out         = outputs[i];
+    out.bytes_written = HostDecompressor::Create(stream_type)
+                          ->Decompress(static_cast<uint8_t *>(in.dstDevice),
+                                       in.dstSize,
+                                       static_cast<uint8_t const *>(in.srcDevice),
+                                       in.srcSize);
+    out.status        = (out.bytes_written != 0) ? 0 : 1;
+    out.reserved      = 0;
+  });
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -23,6 +23,7 @@
 
 #include <io/comp/io_uncomp.h>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/schema_sampling.hpp>
 #include <io/utilities/type_conversion.cuh>
 
 #include <cudf/io/types.hpp>
@@ -35,6 +36,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <tuple>
 #include <unordered_map>
@@ -202,7 +204,8 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
   // This allows only mapping of a subset of the file if using byte range
   if (source_ == nullptr) {
     assert(!filepath_.empty());
-    source_ = datasource::create(filepath_, range_offset, map_range_size);
+    source_ = datasource::create(
+      filepath_, range_offset, map_range_size, opts_.get_source().read_mode);
   }
 
   // Return an empty dataframe if no data and no column metadata to process
@@ -219,31 +222,58 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
       reinterpret_cast<const char *>(buffer->data()),
       buffer->size());
 
-    std::vector<char> h_uncomp_data_owner;
-
-    if (compression_type_ != "none") {
-      h_uncomp_data_owner = get_uncompressed_data(h_data, compression_type_);
-      h_data              = h_uncomp_data_owner;
-    }
     // None of the parameters for row selection is used, we are parsing the entire file
     const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
                                  skip_end_rows <= 0 && num_rows == -1;
 
-    // With byte range, find the start of the first data row
-    size_t const data_start_offset = (range_offset != 0) ? find_first_row_start(h_data) : 0;
-
-    // TODO: Allow parsing the header outside the mapped range
-    CUDF_EXPECTS((range_offset == 0 || opts_.get_header() < 0),
-                 "byte_range offset with header not supported");
+    if (compression_type_ != "none") {
+      // Decompress the input one window at a time while gathering the row offsets, so that the
+      // uncompressed data is never fully held in host memory; with `nrows`, decompression stops
+      // once enough rows have been found
+      auto decompressor = make_stream_decompressor(h_data, compression_type_);
+      std::vector<char> window;
+      gather_row_offsets(
+        [&](size_t, size_t size) {
+          window.resize(size);
+          window.resize(decompressor->read(window));
+          return host_span<char const>(window);
+        },
+        0,
+        0,
+        std::numeric_limits<size_t>::max(),
+        (skip_rows > 0) ? skip_rows : 0,
+        num_rows,
+        (opts_.get_header() >= 0) ? opts_.get_header() + 1 : 0,
+        load_whole_file,
+        stream);
+    } else {
+      // With byte range, find the start of the first data row
+      size_t data_start_offset = (range_offset != 0) ? find_first_row_start(h_data) : 0;
+
+      // The header is outside of a range that does not start at the beginning of the file
+      size_t header_rows     = 0;
+      size_t range_skip_rows = (skip_rows > 0) ? skip_rows : 0;
+      if (range_offset != 0 && opts_.get_header() >= 0) {
+        // The skipped rows precede the header; only those that extend into the range are skipped
+        auto const header_end = read_header(stream);
+        if (header_end > range_offset) {
+          data_start_offset = std::max<size_t>(data_start_offset, header_end - range_offset);
+        }
+        range_skip_rows = 0;
+      } else if (opts_.get_header() >= 0) {
+        header_rows = opts_.get_header() + 1;
+      }
 
-    // Gather row offsets
-    gather_row_offsets(h_data,
-                       data_start_offset,
-                       (range_size) ? range_size : h_data.size(),
-                       (skip_rows > 0) ? skip_rows : 0,
-                       num_rows,
-                       load_whole_file,
-                       stream);
+      // Gather row offsets
+      gather_row_offsets(h_data,
+                         data_start_offset,
+                         (range_size) ? range_size : h_data.size(),
+                         range_skip_rows,
+                         num_rows,
+                         header_rows,
+                         load_whole_file,
+                         stream);
+    }
 
     // Exclude the rows that are to be skipped from the end
     if (skip_end_rows > 0 && static_cast<size_t>(skip_end_rows) < row_offsets_.size()) {
@@ -382,35 +412,123 @@ size_t reader::impl::find_first_row_start(host_span<char const> const data)
   return std::min(pos + 1, data.size());
 }
 
-void reader::impl::gather_row_offsets(host_span<char const> const data,
-                                      size_t range_begin,
-                                      size_t range_end,
-                                      size_t skip_rows,
-                                      int64_t num_rows,
-                                      bool load_whole_file,
-                                      rmm::cuda_stream_view stream)
+table_schema reader::impl::infer_schema(schema_sampling_options const &sampling,
+                                        rmm::cuda_stream_view stream)
+{
+  auto const file_source = (filepath_.empty())
+                             ? std::unique_ptr<datasource>{}
+                             : datasource::create(filepath_, 0, 0, opts_.get_source().read_mode);
+  auto &source = (file_source != nullptr) ? *file_source : *source_;
+  auto const sample =
+    sample_lines(source, compression_type_, opts_.get_lineterminator(), sampling);
+
+  // The sample is read with the same options, with type inference
+  auto sample_options = opts_;
+  sample_options.set_compression(compression_type::NONE);
+  sample_options.set_byte_range_offset(0);
+  sample_options.set_byte_range_size(0);
+  impl sample_reader(datasource::create(host_buffer{sample.data(), sample.size()}),
+                     "",
+                     sample_options,
+                     mr_);
+  return make_table_schema(sample_reader.read(stream));
+}
+
+size_t reader::impl::read_header(rmm::cuda_stream_view stream)
+{
+  constexpr size_t initial_read_size = 64 * 1024;  // 64KB
+
+  // The source of a byte range may only map the range itself
+  auto const file_source = (filepath_.empty())
+                             ? std::unique_ptr<datasource>{}
+                             : datasource::create(filepath_, 0, 0, opts_.get_source().read_mode);
+  auto const source    = (file_source != nullptr) ? file_source.get() : source_.get();
+  auto const skip_rows = (opts_.get_skiprows() > 0) ? opts_.get_skiprows() : 0;
+
+  // Read a growing prefix of the file until it contains the header and the start of the next row
+  for (size_t read_size = initial_read_size;; read_size *= 2) {
+    auto const buffer = source->host_read(0, std::min(read_size, source->size()));
+    auto const prefix =
+      host_span<char const>(reinterpret_cast<const char *>(buffer->data()), buffer->size());
+    auto const data_begin = gather_row_offsets(
+      prefix, 0, prefix.size(), skip_rows, 1, opts_.get_header() + 1, false, stream);
+    if (row_offsets_.size() >= 2) {
+      uint64_t first_row = 0;
+      CUDA_TRY(cudaMemcpyAsync(&first_row,
+                               row_offsets_.data().get(),
+                               sizeof(uint64_t),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+      stream.synchronize();
+      return data_begin + first_row;
+    }
+    if (prefix.size() == source->size()) { return source->size(); }
+  }
+}
+
+size_t reader::impl::gather_row_offsets(host_span<char const> const data,
+                                        size_t range_begin,
+                                        size_t range_end,
+                                        size_t skip_rows,
+                                        int64_t num_rows,
+                                        size_t header_rows,
+                                        bool load_whole_file,
+                                        rmm::cuda_stream_view stream)
+{
+  return gather_row_offsets(
+    [data](size_t offset, size_t size) {
+      offset = std::min(offset, data.size());
+      return host_span<char const>(data.data() + offset, std::min(size, data.size() - offset));
+    },
+    data.size(),
+    range_begin,
+    range_end,
+    skip_rows,
+    num_rows,
+    header_rows,
+    load_whole_file,
+    stream);
+}
+
+size_t reader::impl::gather_row_offsets(input_reader const &read_input,
+                                        size_t data_size,
+                                        size_t range_begin,
+                                        size_t range_end,
+                                        size_t skip_rows,
+                                        int64_t num_rows,
+                                        size_t header_rows,
+                                        bool load_whole_file,
+                                        rmm::cuda_stream_view stream)
 {
   constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
-  size_t buffer_size               = std::min(max_chunk_bytes, data.size());
+  // An unknown size is only determined once the end of the input is reached
+  if (data_size == 0) { data_size = std::numeric_limits<size_t>::max(); }
+  size_t buffer_size = std::min(max_chunk_bytes, data_size);
   size_t max_blocks =
     std::max<size_t>((buffer_size / cudf::io::csv::gpu::rowofs_block_bytes) + 1, 2);
   hostdevice_vector<uint64_t> row_ctx(max_blocks);
-  size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), data.size());
-  size_t pos         = std::min(range_begin, data.size());
-  size_t header_rows = (opts_.get_header() >= 0) ? opts_.get_header() + 1 : 0;
-  uint64_t ctx       = 0;
+  size_t buffer_pos = std::min(range_begin - std::min(range_begin, sizeof(char)), data_size);
+  size_t pos        = std::min(range_begin, data_size);
+  uint64_t ctx      = 0;
 
   // For compatibility with the previous parser, a row is considered in-range if the
   // previous row terminator is within the given range
-  range_end += (range_end < data.size());
+  range_end += (range_end < data_size);
   data_.resize(0);
   row_offsets_.resize(0);
-  data_.reserve((load_whole_file) ? data.size() : std::min(buffer_size * 2, data.size()));
+  if (data_size != std::numeric_limits<size_t>::max()) {
+    data_.reserve((load_whole_file) ? data_size : std::min(buffer_size * 2, data_size));
+  }
   do {
-    size_t target_pos = std::min(pos + max_chunk_bytes, data.size());
-    size_t chunk_size = target_pos - pos;
+    auto const read_pos = buffer_pos + data_.size();
+    auto const chunk    = read_input(read_pos, pos + max_chunk_bytes - read_pos);
+    size_t target_pos   = read_pos + chunk.size();
+    size_t chunk_size   = target_pos - pos;
+    if (target_pos < pos + max_chunk_bytes) { data_size = target_pos; }
+    // Past the current chunk when the end of the input has not been reached yet
+    auto const known_size = std::min(data_size, target_pos + 1);
 
-    data_.insert(data_.end(), data.begin() + buffer_pos + data_.size(), data.begin() + target_pos);
+    data_.insert(data_.end(), chunk.begin(), chunk.end());
 
     // Pass 1: Count the potential number of rows in each character block for each
     // possible parser state at the beginning of the block.
@@ -421,7 +539,7 @@ void reader::impl::gather_row_offsets(host_span<char const> const data,
                                                                  chunk_size,
                                                                  pos,
                                                                  buffer_pos,
-                                                                 data.size(),
+                                                                 known_size,
                                                                  range_begin,
                                                                  range_end,
                                                                  skip_rows,
@@ -460,13 +578,13 @@ void reader::impl::gather_row_offsets(host_span<char const> const data,
                                              chunk_size,
                                              pos,
                                              buffer_pos,
-                                             data.size(),
+                                             known_size,
                                              range_begin,
                                              range_end,
                                              skip_rows,
                                              stream);
       // With byte range, we want to keep only one row out of the specified range
-      if (range_end < data.size()) {
+      if (range_end < data_size) {
         CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
                                  row_ctx.device_ptr(),
                                  num_blocks * sizeof(uint64_t),
@@ -505,15 +623,16 @@ void reader::impl::gather_row_offsets(host_span<char const> const data,
       }
     }
     pos = target_pos;
-  } while (pos < data.size());
+  } while (pos < data_size);
 
   // Eliminate blank rows
   if (row_offsets_.size() != 0) {
     cudf::io::csv::gpu::remove_blank_rows(opts.view(), data_, row_offsets_, stream);
   }
-  // Remove header rows and extract header
+  // Remove header rows and extract header; without header rows, the first row is only used as the
+  // header when no header has been read yet
   const size_t header_row_index = std::max<size_t>(header_rows, 1) - 1;
-  if (header_row_index + 1 < row_offsets_.size()) {
+  if (header_row_index + 1 < row_offsets_.size() && (header_rows > 0 || header_.empty())) {
     CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
                              row_offsets_.data().get() + header_row_index,
                              2 * sizeof(uint64_t),
@@ -521,17 +640,25 @@ void reader::impl::gather_row_offsets(host_span<char const> const data,
                              stream.value()));
     stream.synchronize();
 
-    const auto header_start = buffer_pos + row_ctx[0];
-    const auto header_end   = buffer_pos + row_ctx[1];
-    CUDF_EXPECTS(header_start <= header_end && header_end <= data.size(),
+    // The header is copied from the device, as the input may no longer be available on the host
+    const auto header_start = row_ctx[0];
+    const auto header_end   = row_ctx[1];
+    CUDF_EXPECTS(header_start <= header_end && header_end <= data_.size(),
                  "Invalid csv header location");
-    header_.assign(data.begin() + header_start, data.begin() + header_end);
+    header_.resize(header_end - header_start);
+    CUDA_TRY(cudaMemcpyAsync(header_.data(),
+                             data_.data().get() + header_start,
+                             header_.size(),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
     if (header_rows > 0) {
       row_offsets_.erase(row_offsets_.begin(), row_offsets_.begin() + header_rows);
     }
   }
   // Apply num_rows limit
   if (num_rows >= 0) { row_offsets_.resize(std::min<size_t>(row_offsets_.size(), num_rows + 1)); }
+  return buffer_pos;
 }
 
 std::vector<data_type> reader::impl::gather_column_types(rmm::cuda_stream_view stream)
@@ -805,7 +932,11 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   compression_type_ =
     infer_compression_type(opts_.get_compression(),
                            filepath,
-                           {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
+                           {{"gz", "gzip"},
+                            {"zip", "zip"},
+                            {"bz2", "bz2"},
+                            {"xz", "xz"},
+                            {"zst", "zstd"}});
 
   opts = make_parse_options(options);
 }
@@ -836,6 +967,13 @@ reader::~reader() = default;
 // Forward to implementation
 table_with_metadata reader::read(rmm::cuda_stream_view stream) { return _impl->read(stream); }
 
+// Forward to implementation
+table_schema reader::infer_schema(schema_sampling_options const &sampling,
+                                  rmm::cuda_stream_view stream)
+{
+  return _impl->infer_schema(sampling, stream);
+}
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
@@ -30,6 +30,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -90,6 +91,18 @@ class reader::impl {
    */
   table_with_metadata read(rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Infers the schema of the dataset by reading a sample of its rows.
+   *
+   * The sample is taken from the whole dataset, regardless of the byte range.
+   *
+   * @param sampling Number and size of the samples
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The inferred schema
+   */
+  table_schema infer_schema(schema_sampling_options const &sampling, rmm::cuda_stream_view stream);
+
  private:
   /**
    * @brief Finds row positions within the specified input data.
@@ -103,14 +116,54 @@ class reader::impl {
    * @param range_end Only include rows starting before this position
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read; -1: all remaining data
+   * @param header_rows Number of rows, including the header row, to remove from the start
    * @param load_whole_file Hint that the entire data will be needed on gpu
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Position in the input of the start of `data_`, to which the row offsets are relative
    */
-  void gather_row_offsets(host_span<char const> data,
+  size_t gather_row_offsets(host_span<char const> data,
                           size_t range_begin,
                           size_t range_end,
                           size_t skip_rows,
                           int64_t num_rows,
+                          size_t header_rows,
+                          bool load_whole_file,
+                          rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns up to `size` bytes of the uncompressed input, starting at `offset`.
+   *
+   * Fewer bytes are returned only at the end of the input. Each call starts where the previous
+   * one ended, so the input can be produced incrementally (e.g. by a streaming decompressor).
+   */
+  using input_reader = std::function<host_span<char const>(size_t offset, size_t size)>;
+
+  /**
+   * @brief Finds row positions within input data that is read sequentially in chunks.
+   *
+   * Only the current chunk of the input is held in host memory, and no more input is read once
+   * `num_rows` rows have been found.
+   *
+   * @param read_input Reader of the uncompressed input
+   * @param data_size Size of the input, or zero if it is only known once the end is reached
+   * @param range_begin Only include rows starting after this position
+   * @param range_end Only include rows starting before this position
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; -1: all remaining data
+   * @param header_rows Number of rows, including the header row, to remove from the start
+   * @param load_whole_file Hint that the entire data will be needed on gpu
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Position in the input of the start of `data_`, to which the row offsets are relative
+   */
+  size_t gather_row_offsets(input_reader const& read_input,
+                          size_t data_size,
+                          size_t range_begin,
+                          size_t range_end,
+                          size_t skip_rows,
+                          int64_t num_rows,
+                          size_t header_rows,
                           bool load_whole_file,
                           rmm::cuda_stream_view stream);
 
@@ -123,6 +176,18 @@ class reader::impl {
    */
   size_t find_first_row_start(host_span<char const> data);
 
+  /**
+   * @brief Reads the header row from the start of the input.
+   *
+   * Used when the header is outside of the byte range being read; only the beginning of the file
+   * that contains the skipped rows and the header is read.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Position in the file of the first row after the header
+   */
+  size_t read_header(rmm::cuda_stream_view stream);
+
   /**
    * @brief Returns a detected or parsed list of column dtypes.
    *
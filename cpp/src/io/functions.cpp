@@ -31,8 +31,10 @@
 #include <cudf/utilities/error.hpp>
 
 #include "io/orc/orc.h"
+#include "avro/chunked_state.hpp"
 #include "orc/chunked_state.hpp"
 #include "parquet/chunked_state.hpp"
+#include "parquet/metadata_cache.hpp"
 
 namespace cudf {
 namespace io {
@@ -128,15 +130,35 @@ std::unique_ptr<reader> make_reader(source_info const& src_info,
   return std::make_unique<reader>(std::move(datasources), options, mr);
 }
 
+std::unique_ptr<datasource> make_datasource(source_info const& src_info)
+{
+  if (src_info.type == io_type::FILEPATH) {
+    CUDF_EXPECTS(src_info.filepaths.size() == 1, "Only a single source is currently supported.");
+    return cudf::io::datasource::create(src_info.filepaths[0], 0, 0, src_info.read_mode);
+  } else if (src_info.type == io_type::HOST_BUFFER) {
+    CUDF_EXPECTS(src_info.buffers.size() == 1, "Only a single source is currently supported.");
+    return cudf::io::datasource::create(src_info.buffers[0]);
+  } else if (src_info.type == io_type::USER_IMPLEMENTED) {
+    CUDF_EXPECTS(src_info.user_sources.size() == 1, "Only a single source is currently supported.");
+    return cudf::io::datasource::create(src_info.user_sources[0]);
+  }
+  CUDF_FAIL("Unsupported source type");
+}
+
 template <typename writer, typename writer_options>
 std::unique_ptr<writer> make_writer(sink_info const& sink,
                                     writer_options const& options,
                                     rmm::mr::device_memory_resource* mr)
 {
   if (sink.type == io_type::FILEPATH) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(sink.filepath), options, mr);
+    return std::make_unique<writer>(
+      cudf::io::data_sink::create(sink.filepath, sink.sync_policy), options, mr);
   }
   if (sink.type == io_type::HOST_BUFFER) {
+    if (sink.chunked_buffer != nullptr) {
+      return std::make_unique<writer>(
+        cudf::io::data_sink::create(sink.chunked_buffer), options, mr);
+    }
     return std::make_unique<writer>(cudf::io::data_sink::create(sink.buffer), options, mr);
   }
   if (sink.type == io_type::VOID) {
@@ -160,6 +182,42 @@ table_with_metadata read_avro(avro_reader_options const& opts, rmm::mr::device_m
   return reader->read(opts);
 }
 
+/**
+ * @copydoc cudf::io::read_avro_chunked_begin
+ */
+std::shared_ptr<avro_chunked_state> read_avro_chunked_begin(avro_reader_options const& opts,
+                                                            size_type chunk_rows,
+                                                            rmm::mr::device_memory_resource* mr)
+{
+  namespace avro = cudf::io::detail::avro;
+
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(chunk_rows > 0, "Chunk size must be positive");
+  auto state        = std::make_shared<avro_chunked_state>();
+  state->reader     = make_reader<avro::reader>(opts.get_source(), opts, mr);
+  state->chunk_rows = chunk_rows;
+  state->stream     = 0;
+  return state;
+}
+
+/**
+ * @copydoc cudf::io::read_avro_chunked_has_next
+ */
+bool read_avro_chunked_has_next(std::shared_ptr<avro_chunked_state> const& state)
+{
+  CUDF_FUNC_RANGE();
+  return state->reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::read_avro_chunked
+ */
+table_with_metadata read_avro_chunked(std::shared_ptr<avro_chunked_state> const& state)
+{
+  CUDF_FUNC_RANGE();
+  return state->reader->read_chunk(state->chunk_rows, state->stream);
+}
+
 // Freeform API wraps the detail reader class API
 table_with_metadata read_json(json_reader_options const& opts, rmm::mr::device_memory_resource* mr)
 {
@@ -170,6 +228,17 @@ table_with_metadata read_json(json_reader_options const& opts, rmm::mr::device_m
   return reader->read(opts);
 }
 
+table_schema infer_json_schema(json_reader_options const& opts,
+                               schema_sampling_options const& sampling,
+                               rmm::mr::device_memory_resource* mr)
+{
+  namespace json = cudf::io::detail::json;
+
+  CUDF_FUNC_RANGE();
+  auto reader = make_reader<json::reader>(opts.get_source(), opts, mr);
+  return reader->infer_schema(opts, sampling);
+}
+
 // Freeform API wraps the detail reader class API
 table_with_metadata read_csv(csv_reader_options const& options, rmm::mr::device_memory_resource* mr)
 {
@@ -181,6 +250,48 @@ table_with_metadata read_csv(csv_reader_options const& options, rmm::mr::device_
   return reader->read();
 }
 
+table_schema infer_csv_schema(csv_reader_options const& options,
+                              schema_sampling_options const& sampling,
+                              rmm::mr::device_memory_resource* mr)
+{
+  namespace csv = cudf::io::detail::csv;
+
+  CUDF_FUNC_RANGE();
+  auto reader = make_reader<csv::reader>(options.get_source(), options, mr);
+  return reader->infer_schema(sampling);
+}
+
+std::vector<std::pair<size_t, size_t>> plan_csv_byte_ranges(csv_reader_options const& options,
+                                                            size_t num_ranges)
+{
+  constexpr size_t search_window_size = 64 * 1024;  // 64KB
+
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(num_ranges > 0, "The number of byte ranges must be positive");
+  auto const source = make_datasource(options.get_source());
+  auto const size   = source->size();
+
+  // Each boundary is moved to the next line terminator, so that every range starts with a row
+  std::vector<std::pair<size_t, size_t>> ranges;
+  size_t range_start = 0;
+  for (size_t i = 1; i <= num_ranges && range_start < size; ++i) {
+    auto const target = (size / num_ranges) * i + (size % num_ranges) * i / num_ranges;
+    size_t range_end  = std::max(range_start, target);
+    while (range_end < size) {
+      auto const window =
+        source->host_read(range_end, std::min(search_window_size, size - range_end));
+      auto const window_end = window->data() + window->size();
+      auto const terminator =
+        std::find(window->data(), window_end, static_cast<uint8_t>(options.get_lineterminator()));
+      range_end += terminator - window->data();
+      if (terminator != window_end) { break; }
+    }
+    if (range_end > range_start) { ranges.emplace_back(range_start, range_end - range_start); }
+    range_start = range_end;
+  }
+  return ranges;
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resource* mr)
 {
@@ -197,19 +308,7 @@ namespace detail_orc = cudf::io::detail::orc;
 std::vector<std::vector<std::string>> read_orc_statistics(source_info const& src_info)
 {
   // Get source to read statistics from
-  std::unique_ptr<datasource> source;
-  if (src_info.type == io_type::FILEPATH) {
-    CUDF_EXPECTS(src_info.filepaths.size() == 1, "Only a single source is currently supported.");
-    source = cudf::io::datasource::create(src_info.filepaths[0]);
-  } else if (src_info.type == io_type::HOST_BUFFER) {
-    CUDF_EXPECTS(src_info.buffers.size() == 1, "Only a single source is currently supported.");
-    source = cudf::io::datasource::create(src_info.buffers[0]);
-  } else if (src_info.type == io_type::USER_IMPLEMENTED) {
-    CUDF_EXPECTS(src_info.user_sources.size() == 1, "Only a single source is currently supported.");
-    source = cudf::io::datasource::create(src_info.user_sources[0]);
-  } else {
-    CUDF_FAIL("Unsupported source type");
-  }
+  auto source = make_datasource(src_info);
 
   // Get size of file and size of postscript
   const auto len         = source->size();
@@ -258,15 +357,15 @@ std::vector<std::vector<std::string>> read_orc_statistics(source_info const& src
 
   // Get file-level statistics, statistics of each column of file
   std::vector<std::string> file_column_statistics_blobs;
-  for (orc::ColumnStatistics stats : ff.statistics) {
+  for (auto const& stats : ff.statistics) {
     file_column_statistics_blobs.push_back(std::string(stats.begin(), stats.end()));
   }
   statistics_blobs.push_back(file_column_statistics_blobs);
 
   // Get stripe-level statistics
-  for (orc::StripeStatistics stripe_stats : md.stripeStats) {
+  for (auto const& stripe_stats : md.stripeStats) {
     std::vector<std::string> stripe_column_statistics_blobs;
-    for (orc::ColumnStatistics stats : stripe_stats.colStats) {
+    for (auto const& stats : stripe_stats.colStats) {
       stripe_column_statistics_blobs.push_back(std::string(stats.begin(), stats.end()));
     }
     statistics_blobs.push_back(stripe_column_statistics_blobs);
@@ -349,6 +448,18 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+parquet_metadata_cache_stats get_parquet_metadata_cache_stats()
+{
+  return cudf::io::parquet::metadata_cache::instance().stats();
+}
+
+void set_parquet_metadata_cache_capacity(size_t capacity)
+{
+  cudf::io::parquet::metadata_cache::instance().set_capacity(capacity);
+}
+
+void clear_parquet_metadata_cache() { cudf::io::parquet::metadata_cache::instance().clear(); }
+
 // Freeform API wraps the detail writer class API
 std::unique_ptr<std::vector<uint8_t>> write_parquet(parquet_writer_options const& options,
                                                     rmm::mr::device_memory_resource* mr)
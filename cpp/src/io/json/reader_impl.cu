@@ -23,6 +23,7 @@
 
 #include <io/comp/io_uncomp.h>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/schema_sampling.hpp>
 #include <io/utilities/type_conversion.cuh>
 
 #include <cudf/column/column_factories.hpp>
@@ -243,7 +244,8 @@ void reader::impl::ingest_raw_input(size_t range_offset, size_t range_size)
   // This allows only mapping of a subset of the file if using byte range
   if (source_ == nullptr) {
     assert(!filepath_.empty());
-    source_ = datasource::create(filepath_, range_offset, map_range_size);
+    source_ = datasource::create(
+      filepath_, range_offset, map_range_size, options_.get_source().read_mode);
   }
 
   if (!source_->is_empty()) {
@@ -264,11 +266,7 @@ void reader::impl::ingest_raw_input(size_t range_offset, size_t range_size)
  */
 void reader::impl::decompress_input(rmm::cuda_stream_view stream)
 {
-  const auto compression_type =
-    infer_compression_type(options_.get_compression(),
-                           filepath_,
-                           {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
-  if (compression_type == "none") {
+  if (compression_type_ == "none") {
     // Do not use the owner vector here to avoid extra copy
     uncomp_data_ = reinterpret_cast<const char *>(buffer_->data());
     uncomp_size_ = buffer_->size();
@@ -277,7 +275,7 @@ void reader::impl::decompress_input(rmm::cuda_stream_view stream)
       host_span<char const>(                     //
         reinterpret_cast<const char *>(buffer_->data()),
         buffer_->size()),
-      compression_type);
+      compression_type_);
 
     uncomp_data_ = uncomp_data_owner_.data();
     uncomp_size_ = uncomp_data_owner_.size();
@@ -632,6 +630,14 @@ reader::impl::impl(std::unique_ptr<datasource> source,
 {
   CUDF_EXPECTS(options_.is_enabled_lines(), "Only JSON Lines format is currently supported.\n");
 
+  compression_type_ = infer_compression_type(options_.get_compression(),
+                                             filepath_,
+                                             {{"gz", "gzip"},
+                                              {"zip", "zip"},
+                                              {"bz2", "bz2"},
+                                              {"xz", "xz"},
+                                              {"zst", "zstd"}});
+
   opts_.trie_true  = createSerializedTrie({"true"});
   opts_.trie_false = createSerializedTrie({"false"});
   opts_.trie_na    = createSerializedTrie({"", "null"});
@@ -676,6 +682,29 @@ table_with_metadata reader::impl::read(json_reader_options const &options,
   return convert_data_to_table(stream);
 }
 
+table_schema reader::impl::infer_schema(json_reader_options const &options,
+                                        schema_sampling_options const &sampling,
+                                        rmm::cuda_stream_view stream)
+{
+  auto const file_source = (filepath_.empty())
+                             ? std::unique_ptr<datasource>{}
+                             : datasource::create(filepath_, 0, 0, options.get_source().read_mode);
+  auto &source      = (file_source != nullptr) ? *file_source : *source_;
+  auto const sample = sample_lines(source, compression_type_, '\n', sampling);
+  CUDF_EXPECTS(!sample.empty(), "No data available for data type inference.\n");
+
+  // The sample is read with the same options, with type inference
+  auto sample_options = options;
+  sample_options.compression(compression_type::NONE);
+  sample_options.set_byte_range_offset(0);
+  sample_options.set_byte_range_size(0);
+  impl sample_reader(datasource::create(host_buffer{sample.data(), sample.size()}),
+                     "",
+                     sample_options,
+                     mr_);
+  return make_table_schema(sample_reader.read(sample_options, stream));
+}
+
 // Forward to implementation
 reader::reader(std::vector<std::string> const &filepaths,
                json_reader_options const &options,
@@ -704,6 +733,14 @@ table_with_metadata reader::read(json_reader_options const &options, rmm::cuda_s
 {
   return table_with_metadata{_impl->read(options, stream)};
 }
+
+// Forward to implementation
+table_schema reader::infer_schema(json_reader_options const &options,
+                                  schema_sampling_options const &sampling,
+                                  rmm::cuda_stream_view stream)
+{
+  return _impl->infer_schema(options, sampling, stream);
+}
 }  // namespace json
 }  // namespace detail
 }  // namespace io
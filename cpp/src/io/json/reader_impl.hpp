@@ -59,6 +59,7 @@ class reader::impl {
 
   std::unique_ptr<datasource> source_;
   std::string filepath_;
+  std::string compression_type_;
   std::unique_ptr<datasource::buffer> buffer_;
 
   const char *uncomp_data_ = nullptr;
@@ -192,6 +193,21 @@ class reader::impl {
    * @return Table and its metadata
    */
   table_with_metadata read(json_reader_options const &options, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Infers the schema of the data set by reading a sample of its rows
+   *
+   * The sample is taken from the whole data set, regardless of the byte range.
+   *
+   * @param[in] options Settings for controlling reading behavior
+   * @param[in] sampling Number and size of the samples
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The inferred schema
+   */
+  table_schema infer_schema(json_reader_options const &options,
+                            schema_sampling_options const &sampling,
+                            rmm::cuda_stream_view stream);
 };
 
 }  // namespace json
@@ -120,6 +120,57 @@ bool ProtobufReader::read(Metadata &s, size_t maxlen)
   return function_builder(s, maxlen, op);
 }
 
+bool ProtobufReader::read(RowIndexEntry &s, size_t maxlen)
+{
+  auto op = std::make_tuple(FieldPackedUInt64(1, s.positions));
+  return function_builder(s, maxlen, op);
+}
+
+bool ProtobufReader::read(RowIndex &s, size_t maxlen)
+{
+  auto op = std::make_tuple(FieldRepeatedStruct(1, s.entry));
+  return function_builder(s, maxlen, op);
+}
+
+bool ProtobufReader::read(IntegerStatistics &s, size_t maxlen)
+{
+  auto op = std::make_tuple(FieldOptional(FieldInt64(1, s.minimum), s.has_minimum),
+                            FieldOptional(FieldInt64(2, s.maximum), s.has_maximum));
+  return function_builder(s, maxlen, op);
+}
+
+bool ProtobufReader::read(DoubleStatistics &s, size_t maxlen)
+{
+  auto op = std::make_tuple(FieldOptional(FieldDouble(1, s.minimum), s.has_minimum),
+                            FieldOptional(FieldDouble(2, s.maximum), s.has_maximum));
+  return function_builder(s, maxlen, op);
+}
+
+bool ProtobufReader::read(StringStatistics &s, size_t maxlen)
+{
+  auto op = std::make_tuple(FieldOptional(FieldString(1, s.minimum), s.has_minimum),
+                            FieldOptional(FieldString(2, s.maximum), s.has_maximum));
+  return function_builder(s, maxlen, op);
+}
+
+bool ProtobufReader::read(DateStatistics &s, size_t maxlen)
+{
+  auto op = std::make_tuple(FieldOptional(FieldInt32(1, s.minimum), s.has_minimum),
+                            FieldOptional(FieldInt32(2, s.maximum), s.has_maximum));
+  return function_builder(s, maxlen, op);
+}
+
+bool ProtobufReader::read(DecodedColumnStatistics &s, size_t maxlen)
+{
+  auto op = std::make_tuple(FieldOptional(FieldUInt64(1, s.numberOfValues), s.has_numberOfValues),
+                            FieldStruct(2, s.intStatistics),
+                            FieldStruct(3, s.doubleStatistics),
+                            FieldStruct(4, s.stringStatistics),
+                            FieldStruct(7, s.dateStatistics),
+                            FieldOptional(FieldUInt32(10, s.hasNull), s.has_hasNull));
+  return function_builder(s, maxlen, op);
+}
+
 // return the column name
 std::string FileFooter::GetColumnName(uint32_t column_id)
 {
@@ -314,25 +365,29 @@ size_t ProtobufWriter::write(const Metadata &s)
   return w.value();
 }
 
+int compression_stream_type(CompressionKind kind)
+{
+  switch (kind) {
+    case ZLIB: return IO_UNCOMP_STREAM_TYPE_INFLATE;
+    case SNAPPY: return IO_UNCOMP_STREAM_TYPE_SNAPPY;
+    case LZO: return IO_UNCOMP_STREAM_TYPE_LZO;
+    case LZ4: return IO_UNCOMP_STREAM_TYPE_LZ4;
+    case ZSTD: return IO_UNCOMP_STREAM_TYPE_ZSTD;
+    default: return IO_UNCOMP_STREAM_TYPE_INFER;  // Will be treated as invalid
+  }
+}
+
 OrcDecompressor::OrcDecompressor(CompressionKind kind, uint32_t blockSize)
   : m_kind(kind), m_blockSize(blockSize)
 {
   if (kind != NONE) {
-    int stream_type = IO_UNCOMP_STREAM_TYPE_INFER;  // Will be treated as invalid
     switch (kind) {
-      case ZLIB:
-        stream_type    = IO_UNCOMP_STREAM_TYPE_INFLATE;
-        m_log2MaxRatio = 11;  // < 2048:1
-        break;
-      case SNAPPY:
-        stream_type    = IO_UNCOMP_STREAM_TYPE_SNAPPY;
-        m_log2MaxRatio = 5;  // < 32:1
-        break;
-      case LZO: stream_type = IO_UNCOMP_STREAM_TYPE_LZO; break;
-      case LZ4: stream_type = IO_UNCOMP_STREAM_TYPE_LZ4; break;
-      case ZSTD: stream_type = IO_UNCOMP_STREAM_TYPE_ZSTD; break;
+      case ZLIB: m_log2MaxRatio = 11; break;   // < 2048:1
+      case SNAPPY: m_log2MaxRatio = 5; break;  // < 32:1
+      default: break;
     }
-    m_decompressor = HostDecompressor::Create(stream_type);
+    m_streamType   = compression_stream_type(kind);
+    m_decompressor = HostDecompressor::Create(m_streamType);
   } else {
     m_log2MaxRatio = 0;
   }
@@ -380,24 +435,54 @@ const uint8_t *OrcDecompressor::Decompress(const uint8_t *srcBytes, size_t srcLe
     return srcBytes + 3;
   }
   m_buf.resize(max_dst_length);
-  auto dst          = m_buf.data();
-  size_t dst_length = 0;
+  auto dst = m_buf.data();
+  // Decompress the blocks independently, each into its worst-case slot of the output buffer
+  std::vector<size_t> block_offsets;
+  std::vector<size_t> block_sizes;
+  std::vector<size_t> compressed_blocks;
+  std::vector<gpu_inflate_input_s> inputs;
+  size_t dst_pos = 0;
   for (size_t i = 0; i + 3 < srcLen;) {
     uint32_t block_len       = srcBytes[i] | (srcBytes[i + 1] << 8) | (srcBytes[i + 2] << 16);
     uint32_t is_uncompressed = block_len & 1;
     i += 3;
     block_len >>= 1;
+    block_offsets.push_back(dst_pos);
     if (is_uncompressed) {
       // Uncompressed block
-      memcpy(dst + dst_length, srcBytes + i, block_len);
-      dst_length += block_len;
+      memcpy(dst + dst_pos, srcBytes + i, block_len);
+      block_sizes.push_back(block_len);
+      dst_pos += block_len;
     } else {
       // Compressed block
-      dst_length +=
-        m_decompressor->Decompress(dst + dst_length, m_blockSize, srcBytes + i, block_len);
+      compressed_blocks.push_back(block_sizes.size());
+      inputs.push_back({srcBytes + i, block_len, dst + dst_pos, m_blockSize});
+      block_sizes.push_back(0);
+      dst_pos += m_blockSize;
     }
     i += block_len;
   }
+  if (inputs.size() == 1) {
+    block_sizes[compressed_blocks[0]] =
+      m_decompressor->Decompress(static_cast<uint8_t *>(inputs[0].dstDevice),
+                                 inputs[0].dstSize,
+                                 static_cast<uint8_t const *>(inputs[0].srcDevice),
+                                 inputs[0].srcSize);
+  } else if (inputs.size() > 1) {
+    std::vector<gpu_inflate_status_s> outputs(inputs.size());
+    host_decompress(m_streamType, inputs, outputs);
+    for (size_t b = 0; b < compressed_blocks.size(); ++b) {
+      block_sizes[compressed_blocks[b]] = outputs[b].bytes_written;
+    }
+  }
+  // Close the gaps left by blocks that are smaller than their slot
+  size_t dst_length = 0;
+  for (size_t b = 0; b < block_sizes.size(); ++b) {
+    if (block_offsets[b] != dst_length) {
+      memmove(dst + dst_length, dst + block_offsets[b], block_sizes[b]);
+    }
+    dst_length += block_sizes[b];
+  }
   *dstLen = dst_length;
   return m_buf.data();
 }
@@ -64,7 +64,56 @@ struct UserMetadataItem {
   std::string value;  // the user defined binary value as string
 };
 
-typedef std::vector<uint8_t> ColumnStatistics;  // Column statistics blob
+/**
+ * @brief Column statistics blob
+ *
+ * The blob either owns its bytes, as when built by the writer, or views a metadata buffer that it
+ * shares ownership of, as when decoded by a `ProtobufReader` in view mode; the latter avoids one
+ * allocation per column and stripe when decoding the metadata of wide files. Views remain valid
+ * when the blob, or the structure that holds it, is copied or moved. Only the statistics blobs are
+ * decoded as views; the other strings and vectors of the metadata, such as the schema types and the
+ * stripe footers, are decoded as copies.
+ */
+class ColumnStatistics {
+ public:
+  ColumnStatistics() = default;
+  ColumnStatistics(std::vector<uint8_t> &&blob) : m_owned(std::move(blob)) {}
+
+  /**
+   * @brief Creates a blob that views `size` bytes at `data` within `buffer`, without copying them
+   */
+  static ColumnStatistics view(std::shared_ptr<const std::vector<uint8_t>> buffer,
+                               const uint8_t *data,
+                               size_t size)
+  {
+    ColumnStatistics blob;
+    blob.m_buffer = std::move(buffer);
+    blob.m_view   = data;
+    blob.m_size   = size;
+    return blob;
+  }
+
+  void assign(const uint8_t *first, const uint8_t *last)
+  {
+    m_owned.assign(first, last);
+    m_buffer.reset();
+    m_view = nullptr;
+    m_size = 0;
+  }
+
+  const uint8_t *data() const { return (m_view != nullptr) ? m_view : m_owned.data(); }
+  size_t size() const { return (m_view != nullptr) ? m_size : m_owned.size(); }
+  bool empty() const { return size() == 0; }
+  const uint8_t *begin() const { return data(); }
+  const uint8_t *end() const { return data() + size(); }
+  uint8_t operator[](size_t i) const { return data()[i]; }
+
+ private:
+  std::vector<uint8_t> m_owned;
+  std::shared_ptr<const std::vector<uint8_t>> m_buffer;  // Keeps the viewed bytes alive
+  const uint8_t *m_view = nullptr;
+  size_t m_size         = 0;
+};
 
 struct FileFooter {
   uint64_t headerLength  = 0;                // the length of the file header in bytes (always 3)
@@ -104,6 +153,57 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct RowIndexEntry {
+  std::vector<uint64_t> positions;  // the stream positions at the start of the row group
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // one entry per row group of the stripe
+};
+
+struct IntegerStatistics {
+  int64_t minimum  = 0;
+  int64_t maximum  = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct DoubleStatistics {
+  double minimum   = 0;
+  double maximum   = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct StringStatistics {
+  std::string minimum;
+  std::string maximum;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct DateStatistics {
+  int32_t minimum  = 0;  // min,max values saved as days since epoch
+  int32_t maximum  = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+/**
+ * @brief Decoded column statistics blob; only the fields used to skip stripes are decoded
+ */
+struct DecodedColumnStatistics {
+  uint64_t numberOfValues = 0;  // the number of non-null values
+  IntegerStatistics intStatistics;
+  DoubleStatistics doubleStatistics;
+  StringStatistics stringStatistics;
+  DateStatistics dateStatistics;
+  uint32_t hasNull = 0;  // whether there are null values
+  // Presence of the optional scalar fields
+  bool has_numberOfValues = false;
+  bool has_hasNull        = false;
+};
+
 // Minimal protobuf reader for orc metadata
 
 /**
@@ -114,10 +214,20 @@ class ProtobufReader {
  public:
   ProtobufReader() { m_base = m_cur = m_end = nullptr; }
   ProtobufReader(const uint8_t *base, size_t len) { init(base, len); }
+  /**
+   * @brief Decodes the contents of a shared buffer, with blobs decoded as views into the buffer
+   * rather than copies; the views share ownership of the buffer
+   */
+  void init(std::shared_ptr<const std::vector<uint8_t>> buffer)
+  {
+    init(buffer->data(), buffer->size());
+    m_shared_buffer = std::move(buffer);
+  }
   void init(const uint8_t *base, size_t len)
   {
     m_base = m_cur = base;
     m_end          = base + len;
+    m_shared_buffer.reset();
   }
   ptrdiff_t bytecount() const { return m_cur - m_base; }
   unsigned int getb() { return (m_cur < m_end) ? *m_cur++ : 0; }
@@ -167,6 +277,13 @@ class ProtobufReader {
   bool read(ColumnEncoding &, size_t maxlen);
   bool read(StripeStatistics &, size_t maxlen);
   bool read(Metadata &, size_t maxlen);
+  bool read(RowIndexEntry &, size_t maxlen);
+  bool read(RowIndex &, size_t maxlen);
+  bool read(IntegerStatistics &, size_t maxlen);
+  bool read(DoubleStatistics &, size_t maxlen);
+  bool read(StringStatistics &, size_t maxlen);
+  bool read(DateStatistics &, size_t maxlen);
+  bool read(DecodedColumnStatistics &, size_t maxlen);
 
  protected:
   bool InitSchema(FileFooter &);
@@ -179,9 +296,11 @@ class ProtobufReader {
   struct FieldUInt32;
   struct FieldInt64;
   struct FieldUInt64;
+  struct FieldDouble;
   template <typename Enum>
   struct FieldEnum;
   struct FieldPackedUInt32;
+  struct FieldPackedUInt64;
   struct FieldString;
   struct FieldRepeatedString;
   template <typename Enum>
@@ -198,11 +317,26 @@ class ProtobufReader {
   {
     return FieldRepeatedStructBlobFunctor<Enum>(f, v);
   }
+  template <typename T>
+  struct FieldStructFunctor;
+  template <typename T>
+  FieldStructFunctor<T> FieldStruct(int f, T &v)
+  {
+    return FieldStructFunctor<T>(f, v);
+  }
+  template <typename Field>
+  struct FieldOptionalFunctor;
+  template <typename Field>
+  FieldOptionalFunctor<Field> FieldOptional(Field field, bool &is_set)
+  {
+    return FieldOptionalFunctor<Field>(field, is_set);
+  }
 
  protected:
   const uint8_t *m_base;
   const uint8_t *m_cur;
   const uint8_t *m_end;
+  std::shared_ptr<const std::vector<uint8_t>> m_shared_buffer;  // Set in view mode
 };
 
 /**
@@ -254,6 +388,12 @@ class ProtobufWriter {
   struct ProtobufFieldWriter;
 };
 
+/**
+ * @brief Returns the IO_UNCOMP_STREAM_TYPE_XXX of a compression kind, or
+ * IO_UNCOMP_STREAM_TYPE_INFER if the kind is not supported
+ */
+int compression_stream_type(CompressionKind kind);
+
 /**
  * @brief Class for decompressing Orc data blocks using the CPU
  */
@@ -270,11 +410,13 @@ class OrcDecompressor {
   }
   CompressionKind GetKind() const { return m_kind; }
   uint32_t GetBlockSize() const { return m_blockSize; }
+  int GetStreamType() const { return m_streamType; }
 
  protected:
   CompressionKind const m_kind;
   uint32_t m_log2MaxRatio = 24;  // log2 of maximum compression ratio
   uint32_t const m_blockSize;
+  int m_streamType = IO_UNCOMP_STREAM_TYPE_INFER;
   std::unique_ptr<HostDecompressor> m_decompressor;
   std::vector<uint8_t> m_buf;
 };
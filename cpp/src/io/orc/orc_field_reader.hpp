@@ -16,6 +16,7 @@
 #pragma once
 
 #include <io/orc/orc.h>
+#include <cstring>
 #include <string>
 
 /**
@@ -199,6 +200,26 @@ struct ProtobufReader::FieldUInt64 {
   }
 };
 
+/**
+ * @brief Functor to set value to double read from metadata stream
+ *
+ * Returns 'true' if the value exceeds bounds of the metadata stream
+ */
+struct ProtobufReader::FieldDouble {
+  int field;
+  double &value;
+
+  FieldDouble(int f, double &v) : field((f * 8) + PB_TYPE_FIXED64), value(v) {}
+
+  inline bool operator()(ProtobufReader *pbr, const uint8_t *end)
+  {
+    if (end - pbr->m_cur < static_cast<ptrdiff_t>(sizeof(value))) return true;
+    memcpy(&value, pbr->m_cur, sizeof(value));
+    pbr->m_cur += sizeof(value);
+    return false;
+  }
+};
+
 /**
  * @brief Functor to set value to enum read from metadata stream
  *
@@ -241,6 +262,29 @@ struct ProtobufReader::FieldPackedUInt32 {
   }
 };
 
+/**
+ * @brief Functor to append packed 64 bit integers read from metadata stream
+ * to a vector of 64 bit integers
+ *
+ * Returns 'false'
+ */
+struct ProtobufReader::FieldPackedUInt64 {
+  int field;
+  std::vector<uint64_t> &value;
+
+  FieldPackedUInt64(int f, std::vector<uint64_t> &v) : field((f * 8) + PB_TYPE_FIXEDLEN), value(v)
+  {
+  }
+
+  inline bool operator()(ProtobufReader *pbr, const uint8_t *end)
+  {
+    uint32_t len             = pbr->get_u32();
+    const uint8_t *field_end = std::min(pbr->m_cur + len, end);
+    while (pbr->m_cur < field_end) value.push_back(pbr->get_u64());
+    return false;
+  }
+};
+
 /**
  * @brief Functor to set value to string read from metadata stream
  *
@@ -340,12 +384,59 @@ struct ProtobufReader::FieldRepeatedStructBlobFunctor {
     uint32_t n = pbr->get_u32();
     if (n > (size_t)(end - pbr->m_cur)) return true;
     value.resize(value.size() + 1);
-    value.back().assign(pbr->m_cur, pbr->m_cur + n);
+    if (pbr->m_shared_buffer != nullptr) {
+      value.back() = Enum::view(pbr->m_shared_buffer, pbr->m_cur, n);
+    } else {
+      value.back().assign(pbr->m_cur, pbr->m_cur + n);
+    }
     pbr->m_cur += n;
     return false;
   }
 };
 
+/**
+ * @brief Functor to read a nested message from metadata stream
+ *
+ * Returns 'true' if the maximum length read by the stream could
+ * cause out of bounds read of the buffer or if the process of
+ * reading the struct fails
+ */
+template <typename T>
+struct ProtobufReader::FieldStructFunctor {
+  int field;
+  T &value;
+
+  FieldStructFunctor(int f, T &v) : field((f * 8) + PB_TYPE_FIXEDLEN), value(v) {}
+
+  inline bool operator()(ProtobufReader *pbr, const uint8_t *end)
+  {
+    uint32_t n = pbr->get_u32();
+    if (n > (size_t)(end - pbr->m_cur)) return true;
+    return !pbr->read(value, n);
+  }
+};
+
+/**
+ * @brief Functor to read an optional field with another functor, recording
+ * that the field is present
+ *
+ * Returns the result of the wrapped functor
+ */
+template <typename Field>
+struct ProtobufReader::FieldOptionalFunctor {
+  int field;
+  Field reader;
+  bool &is_set;
+
+  FieldOptionalFunctor(Field f, bool &s) : field(f.field), reader(f), is_set(s) {}
+
+  inline bool operator()(ProtobufReader *pbr, const uint8_t *end)
+  {
+    is_set = true;
+    return reader(pbr, end);
+  }
+};
+
 }  // namespace orc
 }  // namespace io
 }  // namespace cudf
@@ -80,7 +80,7 @@ struct ProtobufWriter::ProtobufFieldWriter {
    * @brief Function to write a blob to the internal buffer
    */
   template <typename T>
-  void field_blob(int field, const std::vector<T> &value)
+  void field_blob(int field, const T &value)
   {
     size_t len = value.size();
     struct_size += p->put_uint(field * 8 + PB_TYPE_FIXEDLEN);
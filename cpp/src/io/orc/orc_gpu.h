@@ -94,6 +94,7 @@ struct ColumnDesc {
   const uint8_t *streams[CI_NUM_STREAMS];  // ptr to data stream index
   uint32_t strm_id[CI_NUM_STREAMS];        // stream ids
   uint32_t strm_len[CI_NUM_STREAMS];       // stream length
+  uint32_t strm_skip[2];  // bytes not read at the start of the CI_DATA and CI_DATA2 streams
   uint32_t *valid_map_base;                // base pointer of valid bit map for this column
   void *column_data_base;                  // base pointer of column data
   uint32_t start_row;                      // starting row of the stripe
@@ -241,6 +242,7 @@ void ParseRowGroupIndex(RowGroup *row_groups,
  * @param[in] num_stripes Number of stripes
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
+ * @param[in] rowidx_stride Row index stride if row index data is used to decode the columns, or 0
  * @param[in] stream CUDA stream to use, default 0
  */
 void DecodeNullsAndStringDictionaries(ColumnDesc *chunks,
@@ -249,6 +251,7 @@ void DecodeNullsAndStringDictionaries(ColumnDesc *chunks,
                                       uint32_t num_stripes,
                                       size_t max_rows              = ~0,
                                       size_t first_row             = 0,
+                                      uint32_t rowidx_stride       = 0,
                                       rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
 /**
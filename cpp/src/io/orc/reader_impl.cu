@@ -23,7 +23,12 @@
 #include "timezone.cuh"
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
+#include <io/utilities/host_parallel.hpp>
+#include <io/utilities/prefetching_source.hpp>
+#include <io/utilities/statistics_filter.hpp>
 
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -34,6 +39,9 @@
 
 #include <algorithm>
 #include <array>
+#include <map>
+#include <memory>
+#include <numeric>
 
 namespace cudf {
 namespace io {
@@ -119,6 +127,52 @@ constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
   }
 }
 
+/**
+ * @brief Decodes the statistics of a column in a stripe for the evaluation of filters.
+ *
+ * @param blob Encoded column statistics
+ * @param type Schema of the column
+ * @param stripe_rows Number of rows in the stripe
+ * @param is_top_level Whether the column is a child of the root column, with a value per row
+ */
+filter_statistics decode_filter_statistics(ColumnStatistics const &blob,
+                                           SchemaType const &type,
+                                           uint32_t stripe_rows,
+                                           bool is_top_level)
+{
+  filter_statistics stats;
+  DecodedColumnStatistics decoded;
+  ProtobufReader pb(blob.data(), blob.size());
+  if (blob.empty() || !pb.read(decoded, blob.size())) { return stats; }
+
+  if (is_top_level) {
+    stats.num_values = stripe_rows;
+    if (decoded.has_numberOfValues && decoded.numberOfValues <= stripe_rows) {
+      stats.null_count = stripe_rows - decoded.numberOfValues;
+    }
+  }
+  if (decoded.has_hasNull && decoded.hasNull == 0) { stats.null_count = 0; }
+
+  auto const set_min_max = [&](auto const &minmax) {
+    if (minmax.has_minimum) { stats.min = filter_literal{minmax.minimum}; }
+    if (minmax.has_maximum) { stats.max = filter_literal{minmax.maximum}; }
+  };
+  switch (type.kind) {
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG: set_min_max(decoded.intStatistics); break;
+    case orc::FLOAT:
+    case orc::DOUBLE: set_min_max(decoded.doubleStatistics); break;
+    case orc::STRING:
+    case orc::VARCHAR:
+    case orc::CHAR: set_min_max(decoded.stringStatistics); break;
+    case orc::DATE: set_min_max(decoded.dateStatistics); break;
+    default: break;
+  }
+  return stats;
+}
+
 }  // namespace
 
 /**
@@ -138,6 +192,7 @@ class metadata {
     auto buffer            = source->host_read(len - max_ps_size, max_ps_size);
     const size_t ps_length = buffer->data()[max_ps_size - 1];
     const uint8_t *ps_data = &buffer->data()[max_ps_size - ps_length - 1];
+    postscript_length      = ps_length;
     ProtobufReader pb;
     pb.init(ps_data, ps_length);
     CUDF_EXPECTS(pb.read(ps, ps_length), "Cannot read postscript");
@@ -151,9 +206,13 @@ class metadata {
     buffer           = source->host_read(len - ps_length - 1 - ps.footerLength, ps.footerLength);
     size_t ff_length = 0;
     auto ff_data     = decompressor->Decompress(buffer->data(), ps.footerLength, &ff_length);
-    pb.init(ff_data, ff_length);
+    // The statistics blobs of the footer are decoded as views into a copy they share
+    pb.init(std::make_shared<const std::vector<uint8_t>>(ff_data, ff_data + ff_length));
     CUDF_EXPECTS(pb.read(ff, ff_length), "Cannot read filefooter");
     CUDF_EXPECTS(get_num_columns() > 0, "No columns found");
+
+    stripefooters.resize(get_num_stripes());
+    has_stripefooter.resize(get_num_stripes(), false);
   }
 
   /**
@@ -213,28 +272,103 @@ class metadata {
 
     // Read each stripe's stripefooter metadata
     if (not selection.empty()) {
-      orc::ProtobufReader pb;
-
-      stripefooters.resize(selection.size());
+      std::vector<size_type> stripe_indices;
+      for (const auto &stripe : selection) {
+        stripe_indices.push_back(static_cast<size_type>(stripe.first - ff.stripes.data()));
+      }
+      read_stripe_footers(stripe_indices);
       for (size_t i = 0; i < selection.size(); ++i) {
-        const auto stripe         = selection[i].first;
-        const auto sf_comp_offset = stripe->offset + stripe->indexLength + stripe->dataLength;
-        const auto sf_comp_length = stripe->footerLength;
-        CUDF_EXPECTS(sf_comp_offset + sf_comp_length < source->size(),
-                     "Invalid stripe information");
-
-        const auto buffer = source->host_read(sf_comp_offset, sf_comp_length);
-        size_t sf_length  = 0;
-        auto sf_data      = decompressor->Decompress(buffer->data(), sf_comp_length, &sf_length);
-        pb.init(sf_data, sf_length);
-        CUDF_EXPECTS(pb.read(stripefooters[i], sf_length), "Cannot read stripefooter");
-        selection[i].second = &stripefooters[i];
+        selection[i].second = &stripefooters[stripe_indices[i]];
       }
     }
 
     return selection;
   }
 
+  /**
+   * @brief Reads the stripefooters of the given stripes, if not read yet
+   *
+   * The footers are requested from the source in a single batch, then decompressed and parsed in
+   * parallel.
+   *
+   * @param[in] stripe_indices Indices of the stripes
+   */
+  void read_stripe_footers(const std::vector<size_type> &stripe_indices)
+  {
+    std::vector<size_type> missing;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (const auto stripe_idx : stripe_indices) {
+      if (has_stripefooter[stripe_idx]) { continue; }
+      const auto &stripe        = ff.stripes[stripe_idx];
+      const auto sf_comp_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+      CUDF_EXPECTS(sf_comp_offset + stripe.footerLength < source->size(),
+                   "Invalid stripe information");
+      missing.push_back(stripe_idx);
+      ranges.emplace_back(sf_comp_offset, stripe.footerLength);
+    }
+    if (missing.empty()) { return; }
+
+    source->prefetch(ranges);
+    host_parallel_for(missing.size(), [&](size_t i) {
+      const auto buffer = source->host_read(ranges[i].first, ranges[i].second);
+      // The decompressor holds the decompressed data, so each footer uses its own
+      OrcDecompressor sf_decompressor(ps.compression, ps.compressionBlockSize);
+      size_t sf_length = 0;
+      auto sf_data = sf_decompressor.Decompress(buffer->data(), ranges[i].second, &sf_length);
+      ProtobufReader pb(sf_data, sf_length);
+      CUDF_EXPECTS(pb.read(stripefooters[missing[i]], sf_length), "Cannot read stripefooter");
+    });
+    for (const auto stripe_idx : missing) { has_stripefooter[stripe_idx] = true; }
+  }
+
+  /**
+   * @brief Removes the stripes whose statistics show that none of their rows match a filter
+   *
+   * @param[in] filter Filter expression
+   * @param[in] stripes Indices of the stripes to filter; empty for all stripes
+   *
+   * @return Indices of the stripes that may contain matching rows
+   */
+  std::vector<size_type> filter_stripes(filter_expression const &filter,
+                                        const std::vector<size_type> &stripes)
+  {
+    std::map<std::string, int> column_ids;
+    for (auto const &name : filter.get_column_names()) {
+      int col = 0;
+      while (col < get_num_columns() && ff.GetColumnName(col) != name) { ++col; }
+      CUDF_EXPECTS(col < get_num_columns(), "Filter column not found");
+      column_ids[name] = col;
+    }
+
+    read_stripe_statistics();
+
+    std::vector<size_type> candidates(stripes);
+    if (candidates.empty()) {
+      candidates.resize(get_num_stripes());
+      std::iota(candidates.begin(), candidates.end(), 0);
+    }
+    std::vector<size_type> filtered;
+    std::copy_if(
+      candidates.cbegin(),
+      candidates.cend(),
+      std::back_inserter(filtered),
+      [&](size_type stripe_idx) {
+        // Invalid indices are reported when the stripes are selected
+        if (stripe_idx < 0 || stripe_idx >= get_num_stripes()) { return true; }
+        if (static_cast<size_t>(stripe_idx) >= md.stripeStats.size()) { return true; }
+        auto const &col_stats = md.stripeStats[stripe_idx].colStats;
+        return may_match(filter, [&](std::string const &name) {
+          auto const col = column_ids.at(name);
+          if (static_cast<size_t>(col) >= col_stats.size()) { return filter_statistics{}; }
+          return decode_filter_statistics(col_stats[col],
+                                          ff.types[col],
+                                          ff.stripes[stripe_idx].numberOfRows,
+                                          ff.types[col].parent_idx == 0);
+        });
+      });
+    return filtered;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
@@ -279,14 +413,35 @@ class metadata {
   inline int get_num_columns() const { return ff.types.size(); }
   inline int get_row_index_stride() const { return ff.rowIndexStride; }
 
+ private:
+  /**
+   * @brief Reads the per-stripe column statistics from the metadata section, if not read yet
+   */
+  void read_stripe_statistics()
+  {
+    if (ps.metadataLength == 0 || not md.stripeStats.empty()) { return; }
+
+    const auto md_offset =
+      source->size() - postscript_length - 1 - ps.footerLength - ps.metadataLength;
+    const auto buffer = source->host_read(md_offset, ps.metadataLength);
+    size_t md_length  = 0;
+    auto md_data      = decompressor->Decompress(buffer->data(), ps.metadataLength, &md_length);
+    ProtobufReader pb;
+    pb.init(std::make_shared<const std::vector<uint8_t>>(md_data, md_data + md_length));
+    CUDF_EXPECTS(pb.read(md, md_length), "Cannot read metadata");
+  }
+
  public:
   PostScript ps;
   FileFooter ff;
-  std::vector<StripeFooter> stripefooters;
+  Metadata md;
+  std::vector<StripeFooter> stripefooters;  // Indexed by stripe; valid once read
   std::unique_ptr<OrcDecompressor> decompressor;
 
  private:
   datasource *const source;
+  size_t postscript_length = 0;
+  std::vector<bool> has_stripefooter;
 };
 
 namespace {
@@ -382,6 +537,154 @@ size_t gather_stream_info(const size_t stripe_index,
   return dst_offset;
 }
 
+/**
+ * @brief Returns the index of the first row index position of the CI_DATA and CI_DATA2 streams of
+ * a column chunk, or -1 for a stream without positions
+ *
+ * Follows the layout decoded by `gpu::ParseRowGroupIndex`: the positions of the streams are in
+ * the order of the streams in the stripe, each starting with the offset of the compression block
+ * if the stripe is compressed.
+ */
+std::array<int, 2> get_data_position_offsets(const gpu::ColumnDesc &chunk, bool is_compressed)
+{
+  // NOTE: skip_count field is still used to track index ordering
+  const uint32_t num_ids  = chunk.skip_count & 0xff;
+  const uint32_t data_id  = (chunk.skip_count >> 8) & 0xff;
+  const uint32_t data2_id = (chunk.skip_count >> 16) & 0xff;
+  const bool is_dictionary =
+    chunk.encoding_kind == orc::DICTIONARY || chunk.encoding_kind == orc::DICTIONARY_V2;
+  const bool data_has_run =
+    is_dictionary || !(chunk.type_kind == orc::STRING || chunk.type_kind == orc::BINARY ||
+                       chunk.type_kind == orc::VARCHAR || chunk.type_kind == orc::CHAR ||
+                       chunk.type_kind == orc::DECIMAL || chunk.type_kind == orc::FLOAT ||
+                       chunk.type_kind == orc::DOUBLE);
+
+  std::array<int, 2> offsets{-1, -1};
+  int pos = 0;
+  for (uint32_t id = 1; id <= num_ids; ++id) {
+    if (id == data_id) {
+      offsets[gpu::CI_DATA] = pos;
+      pos += is_compressed + 1 + data_has_run + (chunk.type_kind == orc::BOOLEAN);
+    } else if (id == data2_id) {
+      // The LENGTH stream of a dictionary only encodes the dictionary, and has no positions
+      if (!is_dictionary) { offsets[gpu::CI_DATA2] = pos; }
+      pos += is_compressed + 2;
+    } else {
+      // PRESENT stream: the offset and bit position within the run follow the run
+      pos += is_compressed + 3;
+    }
+  }
+  return offsets;
+}
+
+/**
+ * @brief Returns the byte range of a stream needed to decode the row groups from `first_rg` up to,
+ * and excluding, `end_rg`
+ *
+ * The row index records for each row group the position of the run holding its first value. The
+ * range starts at that run, or at its compression block, for `first_rg`, and ends at the end of
+ * that run for `end_rg`, as bounded by a later run start or compression block in the row index.
+ *
+ * @param index Row index of the column in the stripe
+ * @param pos Index of the first position of the stream in the row index entries
+ * @param is_compressed Whether the stripe is compressed
+ * @param first_rg First row group to decode
+ * @param end_rg Row group following the last row group to decode
+ * @param length Length of the stream
+ *
+ * @return Range of bytes within the stream, which is the whole stream if the row index does not
+ * allow to narrow it
+ */
+std::pair<size_t, size_t> get_row_groups_stream_range(const RowIndex &index,
+                                                      int pos,
+                                                      bool is_compressed,
+                                                      size_t first_rg,
+                                                      size_t end_rg,
+                                                      size_t length)
+{
+  const auto num_positions = static_cast<size_t>(pos + (is_compressed ? 2 : 1));
+  for (const auto &entry : index.entry) {
+    if (entry.positions.size() < num_positions) { return {0, length}; }
+  }
+  // Returns the block offset and the offset within the block of the run of a row group
+  auto const run_position = [&](size_t rg) {
+    auto const &positions = index.entry[rg].positions;
+    return is_compressed ? std::make_pair(positions[pos], positions[pos + 1])
+                         : std::make_pair(uint64_t{0}, positions[pos]);
+  };
+
+  size_t begin = 0;
+  if (first_rg < index.entry.size()) {
+    auto const first = run_position(first_rg);
+    begin            = is_compressed ? first.first : first.second;
+  }
+  size_t end = length;
+  if (end_rg < index.entry.size()) {
+    auto const last = run_position(end_rg);
+    auto rg         = end_rg + 1;
+    while (rg < index.entry.size() && run_position(rg) <= last) { ++rg; }
+    if (rg < index.entry.size()) {
+      auto const next = run_position(rg);
+      if (!is_compressed) {
+        end = next.second;
+      } else if (next.second == 0) {
+        end = next.first;
+      } else {
+        // The run may end within the block of the next run: read up to the following block
+        while (rg < index.entry.size() && run_position(rg).first <= next.first) { ++rg; }
+        if (rg < index.entry.size()) { end = run_position(rg).first; }
+      }
+    }
+  }
+  if (begin >= end || end > length) { return {0, length}; }
+  return {begin, end};
+}
+
+/**
+ * @brief Narrows the CI_DATA and CI_DATA2 streams of the column chunks of a stripe to the bytes
+ * needed to decode the row groups from `first_rg` up to, and excluding, `end_rg`
+ *
+ * The positions are read from the ROW_INDEX streams of the chunks; the number of bytes skipped at
+ * the start of each stream is recorded in `strm_skip`, to rebase the positions on the device.
+ */
+void seek_row_groups(datasource *source,
+                     OrcDecompressor *decompressor,
+                     size_t stripe_index,
+                     size_t first_rg,
+                     size_t end_rg,
+                     hostdevice_vector<gpu::ColumnDesc> &chunks,
+                     size_t num_columns,
+                     std::vector<orc_stream_info> &stream_info)
+{
+  const bool is_compressed = decompressor->GetKind() != orc::NONE;
+  for (size_t j = 0; j < num_columns; ++j) {
+    auto &chunk = chunks[stripe_index * num_columns + j];
+    if (chunk.strm_len[gpu::CI_INDEX] == 0) { continue; }
+
+    const auto &index_info = stream_info[chunk.strm_id[gpu::CI_INDEX]];
+    const auto buffer      = source->host_read(index_info.offset, index_info.length);
+    size_t index_length    = 0;
+    const auto index_data =
+      decompressor->Decompress(buffer->data(), buffer->size(), &index_length);
+    RowIndex index;
+    ProtobufReader pb(index_data, index_length);
+    if (index_data == nullptr || !pb.read(index, index_length)) { continue; }
+
+    const auto positions = get_data_position_offsets(chunk, is_compressed);
+    for (const auto k : {gpu::CI_DATA, gpu::CI_DATA2}) {
+      if (positions[k] < 0 || chunk.strm_len[k] == 0) { continue; }
+      auto &info       = stream_info[chunk.strm_id[k]];
+      const auto range = get_row_groups_stream_range(
+        index, positions[k], is_compressed, first_rg, end_rg, info.length);
+      chunk.strm_skip[k] = range.first;
+      chunk.strm_len[k]  = range.second - range.first;
+      // Only the narrowed range is read
+      info.offset += range.first;
+      info.length = chunk.strm_len[k];
+    }
+  }
+}
+
 }  // namespace
 
 rmm::device_buffer reader::impl::decompress_stripe_data(
@@ -463,16 +766,24 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
 
   // Dispatch batches of blocks to decompress
   if (num_compressed_blocks > 0) {
-    switch (decompressor->GetKind()) {
-      case orc::ZLIB:
-        CUDA_TRY(gpuinflate(
-          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, 0, stream));
-        break;
-      case orc::SNAPPY:
-        CUDA_TRY(gpu_unsnap(
-          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
-        break;
-      default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
+    const auto kind    = decompressor->GetKind();
+    const bool on_host = prefer_host_decompression();
+    if (kind == orc::ZLIB && !on_host) {
+      CUDA_TRY(gpuinflate(
+        inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, 0, stream));
+    } else if (kind == orc::SNAPPY && !on_host) {
+      CUDA_TRY(gpu_unsnap(
+        inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
+    } else {
+      CUDF_EXPECTS(
+        kind == orc::ZLIB || kind == orc::SNAPPY || kind == orc::LZ4 || kind == orc::ZSTD,
+        "Unexpected decompression dispatch");
+      // No device decoder, or decompression on the host is preferred
+      host_decompress_device(decompressor->GetStreamType(),
+                             inflate_in.data().get(),
+                             inflate_out.data().get(),
+                             num_compressed_blocks,
+                             stream);
     }
   }
   if (num_uncompressed_blocks > 0) {
@@ -562,6 +873,7 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
                                         num_stripes,
                                         num_rows,
                                         skip_rows,
+                                        row_groups.empty() ? 0 : row_index_stride,
                                         stream);
   gpu::DecodeOrcColumnData(chunks.device_ptr(),
                            global_dict.data().get(),
@@ -613,6 +925,49 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   // Control decimals conversion (float64 or int64 with optional scale)
   _decimals_as_float64   = options.is_enabled_decimals_as_float64();
   _decimals_as_int_scale = options.get_forced_decimals_scale();
+
+  // Filter used to skip stripes
+  _filter = options.get_filter();
+}
+
+void reader::impl::read_stripe_footers()
+{
+  std::vector<size_type> stripe_indices(_metadata->get_num_stripes());
+  std::iota(stripe_indices.begin(), stripe_indices.end(), 0);
+  _metadata->read_stripe_footers(stripe_indices);
+}
+
+void reader::impl::check_same_schema(impl const &other) const
+{
+  CUDF_EXPECTS(_selected_columns.size() == other._selected_columns.size(),
+               "Sources have different numbers of columns");
+  for (size_t i = 0; i < _selected_columns.size(); ++i) {
+    auto const &type       = _metadata->ff.types[_selected_columns[i]];
+    auto const &other_type = other._metadata->ff.types[other._selected_columns[i]];
+    CUDF_EXPECTS(type.kind == other_type.kind && type.precision == other_type.precision &&
+                   type.scale == other_type.scale,
+                 "Sources have mismatched column types");
+    CUDF_EXPECTS(_metadata->ff.GetColumnName(_selected_columns[i]) ==
+                   other._metadata->ff.GetColumnName(other._selected_columns[i]),
+                 "Sources have mismatched column names");
+  }
+}
+
+std::vector<std::vector<size_type>> reader::impl::stripe_sets(size_t max_set_size) const
+{
+  std::vector<std::vector<size_type>> sets;
+  size_t set_size = 0;
+  for (size_type i = 0; i < _metadata->get_num_stripes(); ++i) {
+    auto const &stripe     = _metadata->ff.stripes[i];
+    auto const stripe_size = stripe.indexLength + stripe.dataLength;
+    if (sets.empty() || set_size + stripe_size > max_set_size) {
+      sets.emplace_back();
+      set_size = 0;
+    }
+    sets.back().push_back(i);
+    set_size += stripe_size;
+  }
+  return sets;
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
@@ -623,8 +978,19 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata out_metadata;
 
+  // Skip the stripes that cannot contain rows that match the filter
+  std::vector<size_type> filtered_stripes;
+  if (not _filter.matches_all()) {
+    CUDF_EXPECTS(skip_rows == 0 && num_rows == -1,
+                 "skip_rows and num_rows can't be combined with a filter");
+    filtered_stripes = _metadata->filter_stripes(_filter, stripes);
+    // No stripe can contain matching rows
+    if (filtered_stripes.empty()) { num_rows = 0; }
+  }
+
   // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata->select_stripes(stripes, skip_rows, num_rows);
+  const auto selected_stripes = _metadata->select_stripes(
+    _filter.matches_all() ? stripes : filtered_stripes, skip_rows, num_rows);
 
   // Association between each ORC column and its cudf::column
   std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
@@ -653,15 +1019,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     hostdevice_vector<gpu::ColumnDesc> chunks(num_chunks, stream);
     memset(chunks.host_ptr(), 0, chunks.memory_size());
 
+    const auto row_index_stride = _metadata->get_row_index_stride();
     const bool use_index =
       (_use_index == true) &&
-      // Only use if we don't have much work with complete columns & stripes
+      // Only use if we don't have much work with complete columns & stripes, or if only a part of
+      // the stripes is read
       // TODO: Consider nrows, gpu, and tune the threshold
-      (num_rows > _metadata->get_row_index_stride() && !(_metadata->get_row_index_stride() & 7) &&
-       _metadata->get_row_index_stride() > 0 && num_columns * selected_stripes.size() < 8 * 128) &&
-      // Only use if first row is aligned to a stripe boundary
-      // TODO: Fix logic to handle unaligned rows
-      (skip_rows == 0);
+      ((num_rows > row_index_stride || skip_rows > 0) && !(row_index_stride & 7) &&
+       row_index_stride > 0 && num_columns * selected_stripes.size() < 8 * 128);
 
     // Logically view streams as columns
     std::vector<orc_stream_info> stream_info;
@@ -669,17 +1034,16 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> stripe_data;
 
-    size_t stripe_start_row = 0;
+    // Gather the streams of all stripes up front, so that their reads can be issued ahead of
+    // the processing of the earlier stripes
+    std::vector<size_t> stripe_stream_begin;
+    std::vector<size_t> stripe_data_sizes;
     size_t num_dict_entries = 0;
-    size_t num_rowgroups    = 0;
     for (size_t i = 0; i < selected_stripes.size(); ++i) {
-      const auto stripe_info   = selected_stripes[i].first;
-      const auto stripe_footer = selected_stripes[i].second;
-
-      auto stream_count          = stream_info.size();
+      stripe_stream_begin.push_back(stream_info.size());
       const auto total_data_size = gather_stream_info(i,
-                                                      stripe_info,
-                                                      stripe_footer,
+                                                      selected_stripes[i].first,
+                                                      selected_stripes[i].second,
                                                       orc_col_map,
                                                       _selected_columns,
                                                       _metadata->ff.types,
@@ -688,19 +1052,67 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                                       chunks,
                                                       stream_info);
       CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
+      stripe_data_sizes.push_back(total_data_size);
+    }
+    stripe_stream_begin.push_back(stream_info.size());
+
+    // Only read the parts of the first and last stripes holding the row groups to decode
+    if (use_index) {
+      size_t last_stripe_start_row = 0;
+      for (size_t i = 0; i + 1 < selected_stripes.size(); ++i) {
+        last_stripe_start_row += selected_stripes[i].first->numberOfRows;
+      }
+      const size_t end_row = skip_rows + num_rows;
+      for (size_t i = 0; i < selected_stripes.size(); ++i) {
+        const auto stripe_rows = selected_stripes[i].first->numberOfRows;
+        const size_t first_rg  = (i == 0) ? skip_rows / row_index_stride : 0;
+        const size_t end_rg =
+          (i + 1 == selected_stripes.size())
+            ? (end_row - last_stripe_start_row + row_index_stride - 1) / row_index_stride
+            : (stripe_rows + row_index_stride - 1) / row_index_stride;
+        if (first_rg == 0 && end_rg * row_index_stride >= stripe_rows) { continue; }
+
+        seek_row_groups(_source.get(),
+                        _metadata->decompressor.get(),
+                        i,
+                        first_rg,
+                        end_rg,
+                        chunks,
+                        num_columns,
+                        stream_info);
+        size_t dst_offset = 0;
+        for (auto k = stripe_stream_begin[i]; k < stripe_stream_begin[i + 1]; ++k) {
+          stream_info[k].dst_pos = dst_offset;
+          dst_offset += stream_info[k].length;
+        }
+        stripe_data_sizes[i] = dst_offset;
+      }
+    }
+
+    std::vector<std::pair<size_t, size_t>> read_ranges;
+    read_ranges.reserve(stream_info.size());
+    for (const auto &info : stream_info) { read_ranges.emplace_back(info.offset, info.length); }
+    _source->prefetch(read_ranges);
+
+    size_t stripe_start_row = 0;
+    size_t num_rowgroups    = 0;
+    for (size_t i = 0; i < selected_stripes.size(); ++i) {
+      const auto stripe_info   = selected_stripes[i].first;
+      const auto stripe_footer = selected_stripes[i].second;
 
-      stripe_data.emplace_back(total_data_size, stream);
+      stripe_data.emplace_back(stripe_data_sizes[i], stream);
       auto dst_base = static_cast<uint8_t *>(stripe_data.back().data());
 
       // Coalesce consecutive streams into one read
-      while (stream_count < stream_info.size()) {
+      auto stream_count     = stripe_stream_begin[i];
+      const auto stream_end = stripe_stream_begin[i + 1];
+      while (stream_count < stream_end) {
         const auto d_dst  = dst_base + stream_info[stream_count].dst_pos;
         const auto offset = stream_info[stream_count].offset;
         auto len          = stream_info[stream_count].length;
         stream_count++;
 
-        while (stream_count < stream_info.size() &&
-               stream_info[stream_count].offset == offset + len) {
+        while (stream_count < stream_end && stream_info[stream_count].offset == offset + len) {
           len += stream_info[stream_count].length;
           stream_count++;
         }
@@ -829,18 +1241,35 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 reader::reader(std::vector<std::string> const &filepaths,
                orc_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
+  : _mr(mr)
 {
-  CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(datasource::create(filepaths[0]), options, mr);
+  CUDF_EXPECTS(not filepaths.empty(), "No sources to read from");
+  // With several files, the metadata of all files is parsed concurrently
+  _impls.resize(filepaths.size());
+  host_parallel_for(filepaths.size(), [&](size_t i) {
+    _impls[i] = std::make_unique<impl>(
+      cudf::io::detail::make_prefetching_source(
+        datasource::create(filepaths[i], 0, 0, options.get_source().read_mode)),
+      options,
+      mr);
+    if (filepaths.size() > 1) { _impls[i]->read_stripe_footers(); }
+  });
+  for (size_t i = 1; i < _impls.size(); ++i) { _impls[0]->check_same_schema(*_impls[i]); }
 }
 
 // Forward to implementation
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                orc_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
+  : _mr(mr)
 {
-  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(std::move(sources[0]), options, mr);
+  CUDF_EXPECTS(not sources.empty(), "No sources to read from");
+  _impls.resize(sources.size());
+  host_parallel_for(sources.size(), [&](size_t i) {
+    _impls[i] = std::make_unique<impl>(std::move(sources[i]), options, mr);
+    if (sources.size() > 1) { _impls[i]->read_stripe_footers(); }
+  });
+  for (size_t i = 1; i < _impls.size(); ++i) { _impls[0]->check_same_schema(*_impls[i]); }
 }
 
 // Destructor within this translation unit
@@ -849,8 +1278,39 @@ reader::~reader() = default;
 // Forward to implementation
 table_with_metadata reader::read(orc_reader_options const &options, rmm::cuda_stream_view stream)
 {
-  return _impl->read(
-    options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
+  if (_impls.size() == 1) {
+    return _impls[0]->read(
+      options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
+  }
+
+  // Multiple sources are read one after the other, a set of stripes at a time, so that the data
+  // read and decompressed at once is bounded by the size of a set rather than of a whole source;
+  // the decoded tables are then concatenated
+  CUDF_EXPECTS(options.get_skip_rows() == 0 && options.get_num_rows() == -1 &&
+                 options.get_stripes().empty(),
+               "Row and stripe selection is not supported with multiple sources");
+  constexpr size_t max_stripe_set_size = 256 * 1024 * 1024;
+  std::vector<table_with_metadata> results;
+  std::vector<size_t> nonempty_results;
+  for (auto const &impl : _impls) {
+    auto stripe_sets = impl->stripe_sets(max_stripe_set_size);
+    // A source without stripes still yields the (empty) columns and the metadata
+    if (stripe_sets.empty()) { stripe_sets.emplace_back(); }
+    for (auto const &stripes : stripe_sets) {
+      results.push_back(impl->read(0, -1, stripes, stream));
+      if (results.back().tbl->num_rows() != 0) { nonempty_results.push_back(results.size() - 1); }
+    }
+  }
+  auto metadata = std::move(results.front().metadata);
+  if (nonempty_results.size() <= 1) {
+    // A single table holds all rows; it is moved out rather than copied
+    auto const result = nonempty_results.empty() ? 0 : nonempty_results.front();
+    return {std::move(results[result].tbl), std::move(metadata)};
+  }
+
+  std::vector<table_view> views;
+  for (auto const result : nonempty_results) { views.push_back(results[result].tbl->view()); }
+  return {cudf::detail::concatenate(views, stream, _mr), std::move(metadata)};
 }
 }  // namespace orc
 }  // namespace detail
@@ -77,6 +77,29 @@ class reader::impl {
                            const std::vector<size_type> &stripes,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Reads the footers of all stripes ahead of `read()`
+   *
+   * Allows the metadata of several sources to be parsed concurrently.
+   */
+  void read_stripe_footers();
+
+  /**
+   * @brief Checks that the columns selected from another source have the same types and names
+   *
+   * @param other Reader of the other source
+   */
+  void check_same_schema(impl const &other) const;
+
+  /**
+   * @brief Splits the stripes of the source into sets of consecutive stripes to read together
+   *
+   * @param max_set_size Maximum size of the stripe data of a set, unless it is a single stripe
+   *
+   * @return Indices of the stripes of each set
+   */
+  std::vector<std::vector<size_type>> stripe_sets(size_t max_set_size) const;
+
  private:
   /**
    * @brief Decompresses the stripe data, at stream granularity
@@ -136,6 +159,7 @@ class reader::impl {
   bool _decimals_as_float64        = true;
   size_type _decimals_as_int_scale = -1;
   data_type _timestamp_type{type_id::EMPTY};
+  filter_expression _filter;
 };
 
 }  // namespace orc
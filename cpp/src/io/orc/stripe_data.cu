@@ -1108,6 +1108,7 @@ static __device__ int Decode_Decimals(orc_bytestream_s *bs,
  * @param[in] num_stripes Number of stripes
  * @param[in] max_num_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
+ * @param[in] rowidx_stride Row index stride if row index data is used to decode the columns, or 0
  */
 // blockDim {block_size,1,1}
 template <int block_size>
@@ -1117,7 +1118,8 @@ __global__ void __launch_bounds__(block_size)
                                       uint32_t num_columns,
                                       uint32_t num_stripes,
                                       size_t max_num_rows,
-                                      size_t first_row)
+                                      size_t first_row,
+                                      uint32_t rowidx_stride)
 {
   __shared__ __align__(16) orcdec_state_s state_g;
   using warp_reduce = cub::WarpReduce<uint32_t>;
@@ -1134,6 +1136,12 @@ __global__ void __launch_bounds__(block_size)
   __syncthreads();
   if (is_nulldec) {
     uint32_t null_count = 0;
+    // With row index data, the data is decoded from the start of the row group holding first_row,
+    // so only the valid values of that row group below first_row are skipped
+    size_t skip_start_row = s->chunk.start_row;
+    if (rowidx_stride > 0 && first_row > skip_start_row) {
+      skip_start_row = first_row - (first_row - skip_start_row) % rowidx_stride;
+    }
     // Decode NULLs
     if (t == 0) {
       s->chunk.skip_count = 0;
@@ -1207,12 +1215,16 @@ __global__ void __launch_bounds__(block_size)
       }
       // We may have some valid values that are not decoded below first_row -> count these in
       // skip_count, so that subsequent kernel can infer the correct row position
-      if (row_in < first_row && t < 32) {
+      if (row_in < first_row && row_in + nrows > skip_start_row && t < 32) {
         uint32_t skippedrows = min(static_cast<uint32_t>(first_row - row_in), nrows);
+        uint32_t skip_begin  = static_cast<uint32_t>(skip_start_row - min(skip_start_row, row_in));
         uint32_t skip_count  = 0;
         for (uint32_t i = t * 32; i < skippedrows; i += 32 * 32) {
           uint32_t bits = s->vals.u32[i >> 5];
           if (i + 32 > skippedrows) { bits &= (1 << (skippedrows - i)) - 1; }
+          if (i < skip_begin) {
+            bits &= (skip_begin - i < 32) ? ~((1u << (skip_begin - i)) - 1) : 0;
+          }
           skip_count += __popc(bits);
         }
         skip_count = warp_reduce(temp_storage[t / 32]).Sum(skip_count);
@@ -1426,6 +1438,11 @@ __global__ void __launch_bounds__(block_size)
                             s->chunk.num_rows);
       s->chunk.start_row += rowgroup_rowofs;
       s->chunk.num_rows -= rowgroup_rowofs;
+      // Only the row group holding first_row skips values below it; the row groups below it are
+      // not decoded
+      if (first_row < s->chunk.start_row || first_row >= s->chunk.start_row + rowidx_stride) {
+        s->chunk.skip_count = 0;
+      }
     }
     s->is_string = (s->chunk.type_kind == STRING || s->chunk.type_kind == BINARY ||
                     s->chunk.type_kind == VARCHAR || s->chunk.type_kind == CHAR);
@@ -1753,6 +1770,7 @@ __global__ void __launch_bounds__(block_size)
  * @param[in] num_stripes Number of stripes
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
+ * @param[in] rowidx_stride Row index stride if row index data is used to decode the columns, or 0
  * @param[in] stream CUDA stream to use, default 0
  */
 void __host__ DecodeNullsAndStringDictionaries(ColumnDesc *chunks,
@@ -1761,12 +1779,13 @@ void __host__ DecodeNullsAndStringDictionaries(ColumnDesc *chunks,
                                                uint32_t num_stripes,
                                                size_t max_num_rows,
                                                size_t first_row,
+                                               uint32_t rowidx_stride,
                                                rmm::cuda_stream_view stream)
 {
   dim3 dim_block(block_size, 1);
   dim3 dim_grid(num_columns, num_stripes * 2);  // 1024 threads per chunk
   gpuDecodeNullsAndStringDictionaries<block_size><<<dim_grid, dim_block, 0, stream.value()>>>(
-    chunks, global_dictionary, num_columns, num_stripes, max_num_rows, first_row);
+    chunks, global_dictionary, num_columns, num_stripes, max_num_rows, first_row, rowidx_stride);
 }
 
 /**
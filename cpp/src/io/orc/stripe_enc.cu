@@ -19,6 +19,7 @@
 #include <cudf/utilities/bit.hpp>
 #include <io/utilities/block_utils.cuh>
 #include <rmm/cuda_stream_view.hpp>
+#include "orc.h"
 #include "orc_common.h"
 #include "orc_gpu.h"
 
@@ -1324,7 +1325,13 @@ void CompressOrcDataStreams(uint8_t *compressed_data,
   dim3 dim_grid(num_stripe_streams, 1);
   gpuInitCompressionBlocks<<<dim_grid, dim_block_init, 0, stream.value()>>>(
     strm_desc, chunks, comp_in, comp_out, compressed_data, comp_blk_size);
-  if (compression == SNAPPY) { gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); }
+  if (compression == SNAPPY) {
+    gpu_snap(comp_in, comp_out, num_compressed_blocks, stream);
+  } else if (compression != NONE) {
+    // No device encoder; the blocks are compressed on the host
+    host_compress_device(
+      compression_stream_type(compression), comp_in, comp_out, num_compressed_blocks, stream);
+  }
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream.value()>>>(
     strm_desc, comp_in, comp_out, compressed_data, comp_blk_size);
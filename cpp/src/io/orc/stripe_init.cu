@@ -332,6 +332,14 @@ static __device__ void gpuReadRowGroupIndexEntries(rowindex_state_s *s, int num_
         s->rowgroups[i].strm_offset[j] = s->row_index_entry[1][j];
         s->rowgroups[i].run_pos[j]     = s->row_index_entry[2][j];
         s->compressed_offset[i][j]     = s->row_index_entry[0][j];
+        // Positions are relative to the start of the stream in the file, of which the first
+        // strm_skip bytes may not have been read; the row groups before them are not decoded
+        uint32_t skip = s->chunk.strm_skip[j];
+        if (s->is_compressed) {
+          s->compressed_offset[i][j] -= min(s->compressed_offset[i][j], skip);
+        } else {
+          s->rowgroups[i].strm_offset[j] -= min(s->rowgroups[i].strm_offset[j], skip);
+        }
       }
     }
   }
@@ -15,8 +15,13 @@
  */
 #include "timezone.cuh"
 
+#include <cudf/io/orc.hpp>
+
 #include <algorithm>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
 
 namespace cudf {
 namespace io {
@@ -374,13 +379,11 @@ static int64_t get_transition_time(dst_transition_s const &trans, int year)
   return trans.time + day * day_seconds;
 }
 
-timezone_table build_timezone_transition_table(std::string const &timezone_name)
+/**
+ * @brief Builds the transition table of a (non-UTC) timezone from its TZif file.
+ */
+static host_timezone_table build_host_timezone_table(std::string const &timezone_name)
 {
-  if (timezone_name == "UTC" || timezone_name.empty()) {
-    // Return an empty table for UTC
-    return {};
-  }
-
   timezone_file const tzf(timezone_name);
 
   std::vector<int64_t> ttimes(1);
@@ -459,7 +462,74 @@ timezone_table build_timezone_transition_table(std::string const &timezone_name)
     year_timestamp += (365 + is_leap_year(year)) * day_seconds;
   }
 
-  return {get_gmt_offset(ttimes, offsets, orc_utc_offset), ttimes, offsets};
+  auto const gmt_offset = get_gmt_offset(ttimes, offsets, orc_utc_offset);
+  return {gmt_offset, std::move(ttimes), std::move(offsets)};
+}
+
+/**
+ * @brief Process-wide cache of the timezone transition tables, keyed by timezone name.
+ *
+ * Tables are kept in host memory, so that they are not tied to a device or a memory resource, and
+ * are copied to the device for each read.
+ */
+class timezone_table_cache {
+ public:
+  /**
+   * @brief Returns the table of the given timezone, building it on the first request.
+   *
+   * Tables are built under the lock, so that each TZif file is parsed once. Failures are not
+   * cached.
+   */
+  std::shared_ptr<host_timezone_table const> get(std::string const &timezone_name)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _tables.find(timezone_name);
+    if (it == _tables.end()) {
+      auto table = std::make_shared<host_timezone_table const>(
+        build_host_timezone_table(timezone_name));
+      it = _tables.emplace(timezone_name, std::move(table)).first;
+    }
+    return it->second;
+  }
+
+ private:
+  std::mutex _mutex;
+  std::map<std::string, std::shared_ptr<host_timezone_table const>> _tables;
+};
+
+static timezone_table_cache &get_timezone_table_cache()
+{
+  static timezone_table_cache cache;
+  return cache;
+}
+
+static bool is_utc(std::string const &timezone_name)
+{
+  return timezone_name == "UTC" || timezone_name.empty();
+}
+
+timezone_table build_timezone_transition_table(std::string const &timezone_name)
+{
+  if (is_utc(timezone_name)) {
+    // Return an empty table for UTC
+    return {};
+  }
+
+  auto const table = get_host_timezone_table(timezone_name);
+  return {table->gmt_offset, table->ttimes, table->offsets};
+}
+
+std::shared_ptr<host_timezone_table const> get_host_timezone_table(
+  std::string const &timezone_name)
+{
+  return get_timezone_table_cache().get(timezone_name);
+}
+
+void preload_orc_timezones(std::vector<std::string> const &timezone_names)
+{
+  for (auto const &timezone_name : timezone_names) {
+    if (!is_utc(timezone_name)) { get_host_timezone_table(timezone_name); }
+  }
 }
 
 }  // namespace io
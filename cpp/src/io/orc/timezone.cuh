@@ -24,6 +24,7 @@
 #include <thrust/execution_policy.h>
 
 #include <stdint.h>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -106,6 +107,15 @@ inline __device__ int32_t get_gmt_offset(cudf::detail::device_span<int64_t const
   return get_gmt_offset_impl(ttimes.begin(), offsets.begin(), ttimes.size(), ts);
 }
 
+/**
+ * @brief Transition table of a timezone in host memory.
+ */
+struct host_timezone_table {
+  int32_t gmt_offset = 0;
+  std::vector<int64_t> ttimes;
+  std::vector<int32_t> offsets;
+};
+
 struct timezone_table {
   int32_t gmt_offset = 0;
   rmm::device_vector<int64_t> ttimes;
@@ -116,7 +126,8 @@ struct timezone_table {
 /**
  * @brief Creates a transition table to convert ORC timestamps to UTC.
  *
- * Uses system's TZif files. Assumes little-endian platform when parsing these files.
+ * Uses system's TZif files. Assumes little-endian platform when parsing these files. The tables
+ * are cached for the lifetime of the process, so each file is only parsed once.
  *
  * @param timezone_name standard timezone name (for example, "US/Pacific")
  *
@@ -124,5 +135,18 @@ struct timezone_table {
  */
 timezone_table build_timezone_transition_table(std::string const &timezone_name);
 
+/**
+ * @brief Returns the cached host transition table of a (non-UTC) timezone.
+ *
+ * The table is built from the timezone's TZif file on the first request; later requests return
+ * the same table.
+ *
+ * @param timezone_name standard timezone name (for example, "US/Pacific")
+ *
+ * @return The host transition table for the given timezone
+ */
+std::shared_ptr<host_timezone_table const> get_host_timezone_table(
+  std::string const &timezone_name);
+
 }  // namespace io
 }  // namespace cudf
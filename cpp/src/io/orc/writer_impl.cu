@@ -61,6 +61,8 @@ orc::CompressionKind to_orc_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::ZSTD: return orc::CompressionKind::ZSTD;
+    case compression_type::LZ4: return orc::CompressionKind::LZ4;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
@@ -973,24 +975,35 @@ void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
   stripe.dataLength += length;
 }
 
-void writer::impl::add_uncompressed_block_headers(std::vector<uint8_t> &v)
+void writer::impl::add_block_headers(std::vector<uint8_t> &v)
 {
-  if (compression_kind_ != NONE) {
-    size_t uncomp_len = v.size() - 3, pos = 0, block_len;
-    while (uncomp_len > compression_blocksize_) {
-      block_len  = compression_blocksize_ * 2 + 1;
-      v[pos + 0] = static_cast<uint8_t>(block_len >> 0);
-      v[pos + 1] = static_cast<uint8_t>(block_len >> 8);
-      v[pos + 2] = static_cast<uint8_t>(block_len >> 16);
-      pos += 3 + compression_blocksize_;
-      v.insert(v.begin() + pos, 3, 0);
-      uncomp_len -= compression_blocksize_;
+  if (compression_kind_ == NONE) { return; }
+  std::vector<uint8_t> blocks;
+  blocks.reserve(v.size() + 3 * ((v.size() - 3) / compression_blocksize_));
+  auto compressor = HostCompressor::Create(compression_stream_type(compression_kind_));
+  std::vector<uint8_t> comp_buf(compression_blocksize_);
+  size_t pos = 3;
+  do {
+    auto const block_size = std::min<size_t>(v.size() - pos, compression_blocksize_);
+    auto const src        = v.data() + pos;
+    // Compressed blocks larger than the source are discarded, so the source size bounds the output
+    size_t const comp_size =
+      (block_size != 0) ? compressor->Compress(comp_buf.data(), block_size, src, block_size) : 0;
+    // Blocks that do not shrink are stored uncompressed
+    bool const is_compressed = comp_size != 0 && comp_size < block_size;
+    auto const block_len =
+      static_cast<uint32_t>(is_compressed ? comp_size * 2 : block_size * 2 + 1);
+    blocks.push_back(static_cast<uint8_t>(block_len >> 0));
+    blocks.push_back(static_cast<uint8_t>(block_len >> 8));
+    blocks.push_back(static_cast<uint8_t>(block_len >> 16));
+    if (is_compressed) {
+      blocks.insert(blocks.end(), comp_buf.begin(), comp_buf.begin() + comp_size);
+    } else {
+      blocks.insert(blocks.end(), src, src + block_size);
     }
-    block_len  = uncomp_len * 2 + 1;
-    v[pos + 0] = static_cast<uint8_t>(block_len >> 0);
-    v[pos + 1] = static_cast<uint8_t>(block_len >> 8);
-    v[pos + 2] = static_cast<uint8_t>(block_len >> 16);
-  }
+    pos += block_size;
+  } while (pos < v.size());
+  v = std::move(blocks);
 }
 
 writer::impl::impl(std::unique_ptr<data_sink> sink,
@@ -1221,6 +1234,11 @@ void writer::impl::write_chunk(table_view const &table, orc_chunked_state &state
 
   ProtobufWriter pbw_(&buffer_);
 
+  // Data streams make up the bulk of the output; lets in-memory sinks allocate it up front
+  size_t data_streams_size = 0;
+  for (size_t i = 0; i < strm_desc.size(); i++) { data_streams_size += strm_desc[i].stream_size; }
+  out_sink_->set_expected_size(out_sink_->bytes_written() + data_streams_size);
+
   // Write stripes
   size_t group = 0;
   for (size_t stripe_id = 0; stripe_id < stripes.size(); stripe_id++) {
@@ -1275,13 +1293,8 @@ void writer::impl::write_chunk(table_view const &table, orc_chunked_state &state
     }
     buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
     pbw_.write(sf);
+    add_block_headers(buffer_);
     stripes[stripe_id].footerLength = buffer_.size();
-    if (compression_kind_ != NONE) {
-      uint32_t uncomp_sf_len = (stripes[stripe_id].footerLength - 3) * 2 + 1;
-      buffer_[0]             = static_cast<uint8_t>(uncomp_sf_len >> 0);
-      buffer_[1]             = static_cast<uint8_t>(uncomp_sf_len >> 8);
-      buffer_[2]             = static_cast<uint8_t>(uncomp_sf_len >> 16);
-    }
     out_sink_->host_write(buffer_.data(), buffer_.size());
 
     group += groups_in_stripe;
@@ -1367,7 +1380,7 @@ void writer::impl::write_chunked_end(orc_chunked_state &state)
   if (state.md.stripeStats.size() != 0) {
     buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
     pbw_.write(state.md);
-    add_uncompressed_block_headers(buffer_);
+    add_block_headers(buffer_);
     ps.metadataLength = buffer_.size();
     out_sink_->host_write(buffer_.data(), buffer_.size());
   } else {
@@ -1375,7 +1388,7 @@ void writer::impl::write_chunked_end(orc_chunked_state &state)
   }
   buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
   pbw_.write(state.ff);
-  add_uncompressed_block_headers(buffer_);
+  add_block_headers(buffer_);
 
   // Write postscript metadata
   ps.footerLength         = buffer_.size();
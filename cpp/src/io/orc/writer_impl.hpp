@@ -289,11 +289,14 @@ class writer::impl {
                          rmm::cuda_stream_view stream);
 
   /**
-   * @brief Insert 3-byte uncompressed block headers in a byte vector
+   * @brief Splits metadata into compression blocks with 3-byte block headers
+   *
+   * With Snappy compression, the blocks are compressed on the host; blocks that do not shrink
+   * are stored uncompressed.
    *
    * @param byte_vector Raw data (must include initial 3-byte header)
    */
-  void add_uncompressed_block_headers(std::vector<uint8_t>& byte_vector);
+  void add_block_headers(std::vector<uint8_t>& byte_vector);
 
   /**
    * @brief Returns the number of row groups for holding the specified rows
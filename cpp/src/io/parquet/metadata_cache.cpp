@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "metadata_cache.hpp"
+
+#include <sys/stat.h>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+
+metadata_cache &metadata_cache::instance()
+{
+  static metadata_cache cache;
+  return cache;
+}
+
+std::shared_ptr<FileMetaData const> metadata_cache::lookup(std::string const &key)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto const it = entries_.find(key);
+  if (it == entries_.end()) {
+    ++misses_;
+    return nullptr;
+  }
+  ++hits_;
+  lru_.splice(lru_.begin(), lru_, it->second);
+  return it->second->md;
+}
+
+void metadata_cache::insert(std::string const &key,
+                            std::shared_ptr<FileMetaData const> md,
+                            size_t footer_size)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (footer_size > capacity_) { return; }
+
+  auto const it = entries_.find(key);
+  if (it != entries_.end()) {
+    // Another reader parsed the same footer concurrently; keep the newest
+    size_ -= it->second->size;
+    lru_.erase(it->second);
+    entries_.erase(it);
+  }
+  lru_.push_front(entry{key, std::move(md), footer_size});
+  entries_.emplace(key, lru_.begin());
+  size_ += footer_size;
+  evict_to_capacity();
+}
+
+void metadata_cache::set_capacity(size_t capacity)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity;
+  evict_to_capacity();
+}
+
+void metadata_cache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  lru_.clear();
+  size_ = 0;
+}
+
+parquet_metadata_cache_stats metadata_cache::stats()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  parquet_metadata_cache_stats stats;
+  stats.hits        = hits_;
+  stats.misses      = misses_;
+  stats.evictions   = evictions_;
+  stats.num_entries = entries_.size();
+  stats.size        = size_;
+  stats.capacity    = capacity_;
+  return stats;
+}
+
+void metadata_cache::evict_to_capacity()
+{
+  while (size_ > capacity_) {
+    auto const &victim = lru_.back();
+    size_ -= victim.size;
+    entries_.erase(victim.key);
+    lru_.pop_back();
+    ++evictions_;
+  }
+}
+
+std::string file_cache_key(std::string const &filepath)
+{
+  struct stat st;
+  if (stat(filepath.c_str(), &st) != 0) { return {}; }
+  // Separators cannot appear in the numbers, so distinct files cannot produce the same key
+  return filepath + '\0' + std::to_string(st.st_size) + '\0' + std::to_string(st.st_mtim.tv_sec) +
+         '.' + std::to_string(st.st_mtim.tv_nsec);
+}
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
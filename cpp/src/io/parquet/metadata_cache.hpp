@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <io/parquet/parquet.hpp>
+
+#include <cudf/io/parquet.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+/**
+ * @brief Process-wide cache of parsed file footers, bounded by the total size of the encoded
+ * footers and evicted in least-recently-used order.
+ *
+ * Entries are immutable and shared with the readers that use them, so an evicted footer stays
+ * valid for as long as a reader holds it.
+ */
+class metadata_cache {
+ public:
+  static constexpr size_t default_capacity = 256 * 1024 * 1024;
+
+  /**
+   * @brief Returns the process-wide instance.
+   */
+  static metadata_cache &instance();
+
+  /**
+   * @brief Returns the footer cached under the given key, or nullptr if there is none.
+   */
+  std::shared_ptr<FileMetaData const> lookup(std::string const &key);
+
+  /**
+   * @brief Caches a footer, evicting the least recently used entries as needed.
+   *
+   * Footers larger than the capacity are not cached.
+   *
+   * @param key Cache key of the source
+   * @param md Parsed footer
+   * @param footer_size Size of the encoded footer, counted against the capacity
+   */
+  void insert(std::string const &key, std::shared_ptr<FileMetaData const> md, size_t footer_size);
+
+  /**
+   * @brief Sets the capacity, evicting entries as needed.
+   */
+  void set_capacity(size_t capacity);
+
+  /**
+   * @brief Removes all entries; counters are preserved.
+   */
+  void clear();
+
+  /**
+   * @brief Returns a snapshot of the counters.
+   */
+  parquet_metadata_cache_stats stats();
+
+ private:
+  struct entry {
+    std::string key;
+    std::shared_ptr<FileMetaData const> md;
+    size_t size;
+  };
+
+  /**
+   * @brief Evicts the least recently used entries until the cache fits in the capacity.
+   *
+   * Must be called with `mutex_` held.
+   */
+  void evict_to_capacity();
+
+  std::mutex mutex_;
+  std::list<entry> lru_;  ///< Most recently used first
+  std::unordered_map<std::string, std::list<entry>::iterator> entries_;
+  size_t capacity_  = default_capacity;
+  size_t size_      = 0;
+  size_t hits_      = 0;
+  size_t misses_    = 0;
+  size_t evictions_ = 0;
+};
+
+/**
+ * @brief Returns the cache key of a file, made from its path, size and modification time.
+ *
+ * @return The key, or an empty string if the file cannot be queried
+ */
+std::string file_cache_key(std::string const &filepath);
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
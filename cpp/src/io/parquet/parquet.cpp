@@ -143,6 +143,25 @@ bool CompactProtocolReader::read(FileMetaData *f)
   return function_builder(this, op);
 }
 
+/**
+ * @brief Reads the file-level metadata, except for the column chunks of the row groups
+ *
+ * Only the footer offset of each column chunk is recorded (in `RowGroup::column_chunk_offsets`),
+ * so that the chunks of the columns that are actually read can be decoded later. This avoids
+ * decoding the metadata of every column of wide schemas when only a few columns are read.
+ *
+ * @param[out] f File metadata
+ *
+ * @return True if the metadata was read successfully, false otherwise
+ */
+bool CompactProtocolReader::read_deferred(FileMetaData *f)
+{
+  m_defer_column_chunks = true;
+  auto const success    = read(f);
+  m_defer_column_chunks = false;
+  return success;
+}
+
 bool CompactProtocolReader::read(SchemaElement *s)
 {
   auto op = std::make_tuple(ParquetFieldEnum<Type>(1, s->type),
@@ -210,6 +229,12 @@ bool CompactProtocolReader::read(IntType *i)
 
 bool CompactProtocolReader::read(RowGroup *r)
 {
+  if (m_defer_column_chunks) {
+    auto op = std::make_tuple(ParquetFieldStructListOffsets(1, r->column_chunk_offsets),
+                              ParquetFieldInt64(2, r->total_byte_size),
+                              ParquetFieldInt64(3, r->num_rows));
+    return function_builder(this, op);
+  }
   auto op = std::make_tuple(ParquetFieldStructList(1, r->columns),
                             ParquetFieldInt64(2, r->total_byte_size),
                             ParquetFieldInt64(3, r->num_rows));
@@ -244,6 +269,17 @@ bool CompactProtocolReader::read(ColumnChunkMetaData *c)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read(Statistics *s)
+{
+  auto op = std::make_tuple(ParquetFieldString(1, s->max),
+                            ParquetFieldString(2, s->min),
+                            ParquetFieldInt64(3, s->null_count),
+                            ParquetFieldInt64(4, s->distinct_count),
+                            ParquetFieldString(5, s->max_value),
+                            ParquetFieldString(6, s->min_value));
+  return function_builder(this, op);
+}
+
 bool CompactProtocolReader::read(PageHeader *p)
 {
   auto op = std::make_tuple(ParquetFieldEnum<PageType>(1, p->type),
@@ -276,6 +312,30 @@ bool CompactProtocolReader::read(KeyValue *k)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read(PageLocation *p)
+{
+  auto op = std::make_tuple(ParquetFieldInt64(1, p->offset),
+                            ParquetFieldInt32(2, p->compressed_page_size),
+                            ParquetFieldInt64(3, p->first_row_index));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(OffsetIndex *o)
+{
+  auto op = std::make_tuple(ParquetFieldStructList(1, o->page_locations));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(ColumnIndex *c)
+{
+  auto op = std::make_tuple(ParquetFieldBoolList(1, c->null_pages),
+                            ParquetFieldStringList(2, c->min_values),
+                            ParquetFieldStringList(3, c->max_values),
+                            ParquetFieldInt32(4, c->boundary_order),
+                            ParquetFieldInt64List(5, c->null_counts));
+  return function_builder(this, op);
+}
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
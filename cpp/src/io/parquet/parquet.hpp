@@ -227,6 +227,20 @@ struct ColumnChunkMetaData {
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
 };
 
+/**
+ * @brief Thrift-derived struct describing the statistics of a column chunk or page
+ *
+ * Values are PLAIN-encoded, without the length prefix of BYTE_ARRAY values.
+ */
+struct Statistics {
+  std::string max;              // Deprecated maximum value, in signed comparison order
+  std::string min;              // Deprecated minimum value, in signed comparison order
+  int64_t null_count     = -1;  // Number of null values; -1 if not set
+  int64_t distinct_count = -1;  // Number of distinct values; -1 if not set
+  std::string max_value;        // Maximum value, in the sort order of the column
+  std::string min_value;        // Minimum value, in the sort order of the column
+};
+
 /**
  * @brief Thrift-derived struct describing a chunk of data for a particular
  * column
@@ -258,6 +272,14 @@ struct RowGroup {
   int64_t total_byte_size = 0;
   std::vector<ColumnChunk> columns;
   int64_t num_rows = 0;
+
+  // Following fields are derived from other fields
+  std::vector<uint32_t> column_chunk_offsets;  // Footer offsets of deferred column chunks
+
+  size_t num_column_chunks() const
+  {
+    return columns.empty() ? column_chunk_offsets.size() : columns.size();
+  }
 };
 
 /**
@@ -283,6 +305,11 @@ struct FileMetaData {
   std::vector<KeyValue> key_value_metadata;
   std::string created_by         = "";
   uint32_t column_order_listsize = 0;
+
+  // Following fields are derived from other fields
+  std::vector<uint8_t> footer;  // Encoded footer, retained if the column chunks were deferred
+
+  bool has_deferred_column_chunks() const { return !footer.empty(); }
 };
 
 /**
@@ -321,6 +348,35 @@ struct PageHeader {
   DictionaryPageHeader dictionary_page_header;
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page
+ */
+struct PageLocation {
+  int64_t offset               = 0;  // File offset of the page, including its header
+  int32_t compressed_page_size = 0;  // Compressed page size in bytes, including the header
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the locations of the data pages of a column chunk
+ */
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;  // Locations of the data pages, in file order
+};
+
+/**
+ * @brief Thrift-derived struct describing the statistics of the data pages of a column chunk
+ *
+ * Values are encoded like the `min_value` and `max_value` fields of `Statistics`.
+ */
+struct ColumnIndex {
+  std::vector<bool> null_pages;         // Whether each page only contains null values
+  std::vector<std::string> min_values;  // Minimum value of each page; empty for null pages
+  std::vector<std::string> max_values;  // Maximum value of each page; empty for null pages
+  int32_t boundary_order = 0;           // Whether the values are ordered across pages
+  std::vector<int64_t> null_counts;     // Number of null values of each page; empty if not set
+};
+
 /**
  * @brief Count the number of leading zeros in an unsigned integer
  */
@@ -413,6 +469,7 @@ class CompactProtocolReader {
  public:
   // Generate Thrift structure parsing routines
   bool read(FileMetaData *f);
+  bool read_deferred(FileMetaData *f);
   bool read(SchemaElement *s);
   bool read(LogicalType *l);
   bool read(DecimalType *d);
@@ -423,10 +480,14 @@ class CompactProtocolReader {
   bool read(RowGroup *r);
   bool read(ColumnChunk *c);
   bool read(ColumnChunkMetaData *c);
+  bool read(Statistics *s);
   bool read(PageHeader *p);
   bool read(DataPageHeader *d);
   bool read(DictionaryPageHeader *d);
   bool read(KeyValue *k);
+  bool read(PageLocation *p);
+  bool read(OffsetIndex *o);
+  bool read(ColumnIndex *c);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -447,10 +508,14 @@ class CompactProtocolReader {
   const uint8_t *m_cur  = nullptr;
   const uint8_t *m_end  = nullptr;
 
+  bool m_defer_column_chunks = false;
+
   friend class ParquetFieldBool;
   friend class ParquetFieldInt8;
   friend class ParquetFieldInt32;
   friend class ParquetFieldInt64;
+  friend class ParquetFieldBoolList;
+  friend class ParquetFieldInt64List;
   template <typename T>
   friend class ParquetFieldStructListFunctor;
   friend class ParquetFieldString;
@@ -550,6 +615,61 @@ class ParquetFieldInt64 {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of bools from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldBoolList {
+  int field_val;
+  std::vector<bool> &val;
+
+ public:
+  ParquetFieldBoolList(int f, std::vector<bool> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_TRUE && (current_byte & 0xf) != ST_FLD_FALSE) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    // List elements are encoded as one byte each
+    for (int32_t i = 0; i < n; i++) { val[i] = (cpr->getb() == ST_FLD_TRUE); }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a vector of 64 bit integers from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldInt64List {
+  int field_val;
+  std::vector<int64_t> &val;
+
+ public:
+  ParquetFieldInt64List(int f, std::vector<int64_t> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_I64) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) { val[i] = cpr->get_i64(); }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a vector of structures from CompactProtocolReader
  *
@@ -589,6 +709,40 @@ ParquetFieldStructListFunctor<T> ParquetFieldStructList(int f, std::vector<T> &v
   return ParquetFieldStructListFunctor<T>(f, v);
 }
 
+/**
+ * @brief Functor to skip a vector of structures from CompactProtocolReader, recording the offset
+ * of each structure so that it can be read later
+ *
+ * @return True if field types mismatch or if the process of skipping a
+ * struct fails
+ */
+class ParquetFieldStructListOffsets {
+  int field_val;
+  std::vector<uint32_t> &val;
+
+ public:
+  ParquetFieldStructListOffsets(int f, std::vector<uint32_t> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_STRUCT) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      val[i] = static_cast<uint32_t>(cpr->bytecount());
+      if (!cpr->skip_struct_field(ST_FLD_STRUCT)) { return true; }
+    }
+
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a string from CompactProtocolReader
  *
@@ -606,7 +760,7 @@ class ParquetFieldString {
   {
     if (field_type != ST_FLD_BINARY) return true;
     uint32_t n = cpr->get_u32();
-    if (n < (size_t)(cpr->m_end - cpr->m_cur)) {
+    if (n <= (size_t)(cpr->m_end - cpr->m_cur)) {
       val.assign((const char *)cpr->m_cur, n);
       cpr->m_cur += n;
       return false;
@@ -782,7 +936,7 @@ class ParquetFieldStringList {
     val.resize(n);
     for (int32_t i = 0; i < n; i++) {
       uint32_t l = cpr->get_u32();
-      if (l < (size_t)(cpr->m_end - cpr->m_cur)) {
+      if (l <= (size_t)(cpr->m_end - cpr->m_cur)) {
         val[i].assign((const char *)cpr->m_cur, l);
         cpr->m_cur += l;
       } else
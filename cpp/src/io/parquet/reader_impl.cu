@@ -19,9 +19,13 @@
  * @brief cuDF-IO Parquet reader class implementation
  */
 
+#include "metadata_cache.hpp"
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
+#include <io/utilities/prefetching_source.hpp>
+#include <io/utilities/statistics_filter.hpp>
 
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -230,6 +234,235 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Returns the file offset of the first page (dictionary or data) of a column chunk
+ */
+size_t column_chunk_offset(ColumnChunkMetaData const &col_meta)
+{
+  return (col_meta.dictionary_page_offset != 0)
+           ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+           : col_meta.data_page_offset;
+}
+
+/**
+ * @brief Returns true if the column holds unsigned integers.
+ */
+bool is_unsigned_column(SchemaElement const &schema)
+{
+  return schema.converted_type == UINT_8 || schema.converted_type == UINT_16 ||
+         schema.converted_type == UINT_32 || schema.converted_type == UINT_64;
+}
+
+/**
+ * @brief Decodes a PLAIN-encoded statistics value of a column.
+ *
+ * @return The value, or an empty literal if the value cannot be compared with filter literals
+ */
+filter_literal decode_statistics_value(std::string const &bytes, SchemaElement const &schema)
+{
+  switch (schema.type) {
+    case BOOLEAN:
+      if (bytes.size() == 1) { return filter_literal{static_cast<int32_t>(bytes[0] != 0)}; }
+      break;
+    case INT32:
+      if (bytes.size() == sizeof(int32_t)) {
+        int32_t value;
+        memcpy(&value, bytes.data(), sizeof(value));
+        return is_unsigned_column(schema)
+                 ? filter_literal{static_cast<int64_t>(static_cast<uint32_t>(value))}
+                 : filter_literal{value};
+      }
+      break;
+    case INT64:
+      // Unsigned 64-bit values may not be representable as filter literals
+      if (bytes.size() == sizeof(int64_t) && !is_unsigned_column(schema)) {
+        int64_t value;
+        memcpy(&value, bytes.data(), sizeof(value));
+        return filter_literal{value};
+      }
+      break;
+    case FLOAT:
+      if (bytes.size() == sizeof(float)) {
+        float value;
+        memcpy(&value, bytes.data(), sizeof(value));
+        return filter_literal{static_cast<double>(value)};
+      }
+      break;
+    case DOUBLE:
+      if (bytes.size() == sizeof(double)) {
+        double value;
+        memcpy(&value, bytes.data(), sizeof(value));
+        return filter_literal{value};
+      }
+      break;
+    case BYTE_ARRAY: return filter_literal{bytes};
+    default: break;
+  }
+  return filter_literal{};
+}
+
+/**
+ * @brief Decodes the statistics of a column chunk for the evaluation of filters.
+ */
+filter_statistics decode_filter_statistics(ColumnChunkMetaData const &col_meta,
+                                           SchemaElement const &schema)
+{
+  filter_statistics stats;
+  stats.num_values = col_meta.num_values;
+  if (col_meta.statistics_blob.empty()) { return stats; }
+
+  Statistics chunk_stats;
+  CompactProtocolReader cp(col_meta.statistics_blob.data(), col_meta.statistics_blob.size());
+  if (!cp.read(&chunk_stats)) { return stats; }
+
+  stats.null_count = chunk_stats.null_count;
+  if (!chunk_stats.min_value.empty() || !chunk_stats.max_value.empty()) {
+    stats.min = decode_statistics_value(chunk_stats.min_value, schema);
+    stats.max = decode_statistics_value(chunk_stats.max_value, schema);
+  } else if (schema.type != BYTE_ARRAY && schema.type != FIXED_LEN_BYTE_ARRAY &&
+             !is_unsigned_column(schema)) {
+    // The deprecated fields use signed comparison, which is only correct for signed numbers
+    stats.min = decode_statistics_value(chunk_stats.min, schema);
+    stats.max = decode_statistics_value(chunk_stats.max, schema);
+  }
+  return stats;
+}
+
+/**
+ * @brief Decodes the statistics of a data page from a column index for the evaluation of filters.
+ *
+ * @param column_index Column index of the column chunk
+ * @param page Index of the page
+ * @param num_values Number of values in the page
+ * @param schema Schema of the column
+ */
+filter_statistics decode_filter_statistics(ColumnIndex const &column_index,
+                                           size_t page,
+                                           int64_t num_values,
+                                           SchemaElement const &schema)
+{
+  filter_statistics stats;
+  stats.num_values = num_values;
+  if (page < column_index.null_counts.size()) { stats.null_count = column_index.null_counts[page]; }
+  if (column_index.null_pages[page]) {
+    stats.null_count = num_values;
+  } else {
+    stats.min = decode_statistics_value(column_index.min_values[page], schema);
+    stats.max = decode_statistics_value(column_index.max_values[page], schema);
+  }
+  return stats;
+}
+
+/**
+ * @brief Reads a page index structure (`OffsetIndex` or `ColumnIndex`) of a column chunk.
+ *
+ * @return True if the structure was read successfully
+ */
+template <typename T>
+bool read_page_index(datasource *source, int64_t offset, int32_t length, T *index)
+{
+  if (offset <= 0 || length <= 0 || static_cast<size_t>(offset) + length > source->size()) {
+    return false;
+  }
+  auto const buffer = source->host_read(offset, length);
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  return cp.read(index);
+}
+
+/**
+ * @brief Returns true if the offset index describes contiguous data pages within the column
+ * chunk, covering all the rows of the row group.
+ */
+bool is_valid_offset_index(OffsetIndex const &offset_index,
+                           ColumnChunkMetaData const &col_meta,
+                           int64_t row_group_rows)
+{
+  auto const &pages = offset_index.page_locations;
+  if (pages.empty() || pages[0].first_row_index != 0) { return false; }
+  auto const chunk_start = static_cast<int64_t>(column_chunk_offset(col_meta));
+  auto const chunk_end   = chunk_start + col_meta.total_compressed_size;
+  if (pages[0].offset < chunk_start) { return false; }
+  for (size_t i = 0; i < pages.size(); ++i) {
+    if (pages[i].compressed_page_size <= 0 ||
+        pages[i].offset + pages[i].compressed_page_size > chunk_end ||
+        pages[i].first_row_index >= row_group_rows) {
+      return false;
+    }
+    if (i != 0 && (pages[i].offset != pages[i - 1].offset + pages[i - 1].compressed_page_size ||
+                   pages[i].first_row_index <= pages[i - 1].first_row_index)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief The part of a column chunk that is read: the dictionary page, if any, followed by a
+ * contiguous run of data pages.
+ */
+struct chunk_read_range {
+  size_t offset     = 0;   // File offset of the first byte to read
+  size_t size       = 0;   // Number of bytes to read, excluding the skipped bytes
+  size_t gap_start  = 0;   // Offset within the read bytes where the data pages are skipped
+  size_t gap_size   = 0;   // Number of bytes of the skipped data pages
+  int64_t first_row = 0;   // First row of the read data pages, relative to the row group
+  int64_t num_rows  = -1;  // Number of rows of the read data pages; -1 if the whole chunk is read
+};
+
+/**
+ * @brief Selects the data pages of a column chunk that overlap a range of rows.
+ *
+ * @param col_meta Metadata of a column chunk without repetition levels
+ * @param offset_index Valid offset index of the column chunk
+ * @param row_group_rows Number of rows of the row group
+ * @param first_row First row to read, relative to the row group
+ * @param end_row End of the rows to read, relative to the row group
+ *
+ * @return The part of the column chunk to read
+ */
+chunk_read_range select_pages(ColumnChunkMetaData const &col_meta,
+                              OffsetIndex const &offset_index,
+                              int64_t row_group_rows,
+                              int64_t first_row,
+                              int64_t end_row)
+{
+  auto const &pages  = offset_index.page_locations;
+  auto const end_row_of = [&](size_t page) {
+    return (page + 1 < pages.size()) ? pages[page + 1].first_row_index : row_group_rows;
+  };
+
+  size_t first_page = 0;
+  while (first_page + 1 < pages.size() && end_row_of(first_page) <= first_row) { ++first_page; }
+  size_t last_page = first_page;
+  while (last_page + 1 < pages.size() && pages[last_page + 1].first_row_index < end_row) {
+    ++last_page;
+  }
+
+  chunk_read_range range;
+  if (first_page == 0 && last_page + 1 == pages.size()) {
+    range.offset = column_chunk_offset(col_meta);
+    range.size   = col_meta.total_compressed_size;
+    return range;
+  }
+
+  // The dictionary page, if any, precedes the first data page
+  auto const chunk_start = column_chunk_offset(col_meta);
+  auto const dict_size   = static_cast<size_t>(pages[0].offset) - chunk_start;
+  auto const pages_size =
+    pages[last_page].offset + pages[last_page].compressed_page_size - pages[first_page].offset;
+  if (dict_size == 0) {
+    range.offset = pages[first_page].offset;
+  } else {
+    range.offset    = chunk_start;
+    range.gap_start = dict_size;
+    range.gap_size  = pages[first_page].offset - pages[0].offset;
+  }
+  range.size      = dict_size + pages_size;
+  range.first_row = pages[first_page].first_row_index;
+  range.num_rows  = end_row_of(last_page) - range.first_row;
+  return range;
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string> &path_in_schema)
@@ -270,47 +503,78 @@ std::string name_from_path(const std::vector<std::string> &path_in_schema)
 }
 
 /**
- * @brief Class for parsing dataset metadata
+ * @brief Parses the footer of a source
+ *
+ * @param source The source to read the footer from
+ * @param defer_column_chunks Whether to only decode the column chunks once they are selected
+ *
+ * @return The parsed footer and the size of the encoded footer
  */
-struct metadata : public FileMetaData {
-  explicit metadata(datasource *source)
-  {
-    constexpr auto header_len = sizeof(file_header_s);
-    constexpr auto ender_len  = sizeof(file_ender_s);
-
-    const auto len           = source->size();
-    const auto header_buffer = source->host_read(0, header_len);
-    const auto header        = reinterpret_cast<const file_header_s *>(header_buffer->data());
-    const auto ender_buffer  = source->host_read(len - ender_len, ender_len);
-    const auto ender         = reinterpret_cast<const file_ender_s *>(ender_buffer->data());
-    CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
-    CUDF_EXPECTS(header->magic == parquet_magic && ender->magic == parquet_magic,
-                 "Corrupted header or footer");
-    CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
-                 "Incorrect footer length");
-
-    const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
-    CompactProtocolReader cp(buffer->data(), ender->footer_len);
-    CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
-    CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+std::pair<std::shared_ptr<FileMetaData const>, size_t> parse_metadata(datasource *source,
+                                                                      bool defer_column_chunks)
+{
+  constexpr auto header_len = sizeof(file_header_s);
+  constexpr auto ender_len  = sizeof(file_ender_s);
+
+  const auto len           = source->size();
+  const auto header_buffer = source->host_read(0, header_len);
+  const auto header        = reinterpret_cast<const file_header_s *>(header_buffer->data());
+  const auto ender_buffer  = source->host_read(len - ender_len, ender_len);
+  const auto ender         = reinterpret_cast<const file_ender_s *>(ender_buffer->data());
+  CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
+  CUDF_EXPECTS(header->magic == parquet_magic && ender->magic == parquet_magic,
+               "Corrupted header or footer");
+  CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
+               "Incorrect footer length");
+
+  auto md           = std::make_shared<FileMetaData>();
+  const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
+  CompactProtocolReader cp(buffer->data(), ender->footer_len);
+  if (defer_column_chunks) {
+    CUDF_EXPECTS(cp.read_deferred(md.get()), "Cannot parse metadata");
+    md->footer.assign(buffer->data(), buffer->data() + ender->footer_len);
+  } else {
+    CUDF_EXPECTS(cp.read(md.get()), "Cannot parse metadata");
   }
-};
+  CUDF_EXPECTS(cp.InitSchema(md.get()), "Cannot initialize schema");
+  return {std::move(md), ender->footer_len};
+}
 
 class aggregate_metadata {
-  std::vector<metadata> const per_file_metadata;
+  std::vector<std::shared_ptr<FileMetaData const>> const per_file_metadata;
   std::map<std::string, std::string> const agg_keyval_map;
   size_type const num_rows;
   size_type const num_row_groups;
+  // Decoded column chunks of the selected columns, per source and row group; only used for
+  // sources whose column chunks were deferred
+  std::vector<std::vector<std::vector<ColumnChunk>>> decoded_column_chunks;
   /**
    * @brief Create a metadata object from each element in the source vector
+   *
+   * Sources with a non-empty cache key are looked up in, and added to, the metadata cache.
    */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources)
+  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources,
+                              std::vector<std::string> const &cache_keys,
+                              bool defer_column_chunks)
   {
-    std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const &source) {
-        return metadata(source.get());
-      });
+    CUDF_EXPECTS(cache_keys.empty() || cache_keys.size() == sources.size(),
+                 "Mismatch between the number of sources and metadata cache keys");
+    std::vector<std::shared_ptr<FileMetaData const>> metadatas;
+    for (size_t src_idx = 0; src_idx < sources.size(); ++src_idx) {
+      auto const use_cache = !cache_keys.empty() && !cache_keys[src_idx].empty();
+      if (use_cache) {
+        auto cached = metadata_cache::instance().lookup(cache_keys[src_idx]);
+        if (cached != nullptr) {
+          metadatas.push_back(std::move(cached));
+          continue;
+        }
+      }
+      auto parsed = parse_metadata(sources[src_idx].get(), defer_column_chunks);
+      if (use_cache) {
+        metadata_cache::instance().insert(cache_keys[src_idx], parsed.first, parsed.second);
+      }
+      metadatas.push_back(std::move(parsed.first));
+    }
     return metadatas;
   }
 
@@ -322,7 +586,7 @@ class aggregate_metadata {
     std::map<std::string, std::string> merged;
     // merge key/value maps TODO: warn/throw if there are mismatches?
     for (auto const &pfm : per_file_metadata) {
-      for (auto const &kv : pfm.key_value_metadata) { merged[kv.key] = kv.value; }
+      for (auto const &kv : pfm->key_value_metadata) { merged[kv.key] = kv.value; }
     }
     return merged;
   }
@@ -334,7 +598,7 @@ class aggregate_metadata {
   {
     return std::accumulate(
       per_file_metadata.begin(), per_file_metadata.end(), 0, [](auto &sum, auto &pfm) {
-        return sum + pfm.num_rows;
+        return sum + pfm->num_rows;
       });
   }
 
@@ -345,31 +609,34 @@ class aggregate_metadata {
   {
     return std::accumulate(
       per_file_metadata.begin(), per_file_metadata.end(), 0, [](auto &sum, auto &pfm) {
-        return sum + pfm.row_groups.size();
+        return sum + pfm->row_groups.size();
       });
   }
 
  public:
-  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const &sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const &sources,
+                     std::vector<std::string> const &cache_keys,
+                     bool defer_column_chunks)
+    : per_file_metadata(metadatas_from_sources(sources, cache_keys, defer_column_chunks)),
       agg_keyval_map(merge_keyval_metadata()),
       num_rows(calc_num_rows()),
-      num_row_groups(calc_num_row_groups())
+      num_row_groups(calc_num_row_groups()),
+      decoded_column_chunks(per_file_metadata.size())
   {
     // Verify that the input files have matching numbers of columns
     size_type num_cols = -1;
     for (auto const &pfm : per_file_metadata) {
-      if (pfm.row_groups.size() != 0) {
+      if (pfm->row_groups.size() != 0) {
         if (num_cols == -1)
-          num_cols = pfm.row_groups[0].columns.size();
+          num_cols = pfm->row_groups[0].num_column_chunks();
         else
-          CUDF_EXPECTS(num_cols == static_cast<size_type>(pfm.row_groups[0].columns.size()),
+          CUDF_EXPECTS(num_cols == static_cast<size_type>(pfm->row_groups[0].num_column_chunks()),
                        "All sources must have the same number of columns");
       }
     }
     // Verify that the input files have matching schemas
     for (auto const &pfm : per_file_metadata) {
-      CUDF_EXPECTS(per_file_metadata[0].schema == pfm.schema,
+      CUDF_EXPECTS(per_file_metadata[0]->schema == pfm->schema,
                    "All sources must have the same schemas");
     }
   }
@@ -378,27 +645,232 @@ class aggregate_metadata {
   {
     CUDF_EXPECTS(src_idx >= 0 && src_idx < static_cast<size_type>(per_file_metadata.size()),
                  "invalid source index");
-    return per_file_metadata[src_idx].row_groups[row_group_index];
+    return per_file_metadata[src_idx]->row_groups[row_group_index];
+  }
+
+  auto const &get_column_chunk(size_type row_group_index, size_type src_idx, int schema_idx) const
+  {
+    auto const &columns = per_file_metadata[src_idx]->has_deferred_column_chunks()
+                            ? decoded_column_chunks[src_idx][row_group_index]
+                            : per_file_metadata[src_idx]->row_groups[row_group_index].columns;
+    auto col = std::find_if(columns.begin(), columns.end(), [schema_idx](ColumnChunk const &col) {
+      return col.schema_idx == schema_idx ? true : false;
+    });
+    CUDF_EXPECTS(col != std::end(columns), "Found no metadata for schema index");
+    return *col;
   }
 
   auto const &get_column_metadata(size_type row_group_index,
                                   size_type src_idx,
                                   int schema_idx) const
   {
-    auto col = std::find_if(
-      per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
-      per_file_metadata[src_idx].row_groups[row_group_index].columns.end(),
-      [schema_idx](ColumnChunk const &col) { return col.schema_idx == schema_idx ? true : false; });
-    CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
-                 "Found no metadata for schema index");
-    return col->meta_data;
+    return get_column_chunk(row_group_index, src_idx, schema_idx).meta_data;
+  }
+
+  /**
+   * @brief Decodes the deferred column chunks of the given leaf columns
+   *
+   * Column chunks are stored in the order of the leaves of the schema, which allows finding the
+   * chunks of the selected columns without decoding the other ones.
+   *
+   * @param schema_indices Schema indices of the leaf columns to decode
+   */
+  void decode_column_chunks(std::vector<int> const &schema_indices)
+  {
+    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      auto const &pfm = *per_file_metadata[src_idx];
+      if (!pfm.has_deferred_column_chunks()) { continue; }
+
+      std::vector<int> leaf_schema_indices;
+      for (size_t schema_idx = 1; schema_idx < pfm.schema.size(); ++schema_idx) {
+        if (pfm.schema[schema_idx].num_children == 0) { leaf_schema_indices.push_back(schema_idx); }
+      }
+
+      auto &decoded = decoded_column_chunks[src_idx];
+      decoded.resize(pfm.row_groups.size());
+      for (size_t rg_idx = 0; rg_idx < pfm.row_groups.size(); ++rg_idx) {
+        auto const &offsets = pfm.row_groups[rg_idx].column_chunk_offsets;
+        CUDF_EXPECTS(offsets.size() == leaf_schema_indices.size(),
+                     "Number of column chunks does not match the schema");
+        for (auto const schema_idx : schema_indices) {
+          auto const leaf =
+            std::find(leaf_schema_indices.cbegin(), leaf_schema_indices.cend(), schema_idx);
+          CUDF_EXPECTS(leaf != leaf_schema_indices.cend(), "Selected column is not a leaf");
+          auto const chunk_idx = std::distance(leaf_schema_indices.cbegin(), leaf);
+
+          ColumnChunk chunk;
+          CompactProtocolReader cp(pfm.footer.data() + offsets[chunk_idx],
+                                   pfm.footer.size() - offsets[chunk_idx]);
+          CUDF_EXPECTS(cp.read(&chunk), "Cannot parse column chunk metadata");
+          CUDF_EXPECTS(!chunk.meta_data.path_in_schema.empty() &&
+                         chunk.meta_data.path_in_schema.back() == pfm.schema[schema_idx].name,
+                       "Column chunk does not match the schema");
+          chunk.schema_idx = schema_idx;
+          decoded[rg_idx].push_back(std::move(chunk));
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the schema index of a leaf column, given its dot-separated path
+   */
+  int find_leaf_schema_index(std::string const &path) const
+  {
+    auto const &schema = per_file_metadata[0]->schema;
+    for (size_t schema_idx = 1; schema_idx < schema.size(); ++schema_idx) {
+      if (schema[schema_idx].num_children != 0) { continue; }
+      auto leaf_path = schema[schema_idx].name;
+      for (auto parent = schema[schema_idx].parent_idx; parent > 0;
+           parent      = schema[parent].parent_idx) {
+        leaf_path = schema[parent].name + "." + leaf_path;
+      }
+      if (leaf_path == path) { return schema_idx; }
+    }
+    CUDF_FAIL("Filter column not found");
+  }
+
+  /**
+   * @brief Removes the row groups whose statistics show that none of their rows match a filter
+   *
+   * @param filter Filter expression
+   * @param row_groups Row groups to filter, per source; empty for all row groups
+   *
+   * @return The row groups that may contain matching rows, per source
+   */
+  std::vector<std::vector<size_type>> filter_row_groups(
+    filter_expression const &filter, std::vector<std::vector<size_type>> const &row_groups) const
+  {
+    CUDF_EXPECTS(row_groups.empty() || row_groups.size() == per_file_metadata.size(),
+                 "Must specify row groups for each source");
+    std::map<std::string, int> schema_indices;
+    for (auto const &name : filter.get_column_names()) {
+      schema_indices[name] = find_leaf_schema_index(name);
+    }
+
+    std::vector<std::vector<size_type>> filtered(per_file_metadata.size());
+    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      auto const num_src_row_groups =
+        static_cast<size_type>(per_file_metadata[src_idx]->row_groups.size());
+      std::vector<size_type> candidates;
+      if (row_groups.empty()) {
+        candidates.resize(num_src_row_groups);
+        std::iota(candidates.begin(), candidates.end(), 0);
+      } else {
+        candidates = row_groups[src_idx];
+      }
+
+      std::copy_if(candidates.cbegin(),
+                   candidates.cend(),
+                   std::back_inserter(filtered[src_idx]),
+                   [&](size_type rg_idx) {
+                     // Invalid indices are reported when the row groups are selected
+                     if (rg_idx < 0 || rg_idx >= num_src_row_groups) { return true; }
+                     return may_match(filter, [&](std::string const &name) {
+                       auto const schema_idx = schema_indices.at(name);
+                       return decode_filter_statistics(
+                         get_column_metadata(rg_idx, src_idx, schema_idx), get_schema(schema_idx));
+                     });
+                   });
+    }
+    return filtered;
+  }
+
+  /**
+   * @brief Returns the rows of a row group that may match a filter, according to the statistics
+   * of the data pages in the column indexes of the filtered columns
+   *
+   * @param filter Filter expression
+   * @param rg_idx Index of the row group
+   * @param src_idx Index of the source of the row group
+   * @param source Source of the row group, to read the page indexes from
+   *
+   * @return Range of rows, relative to the row group, that contains all the matching rows; all
+   * rows if the page statistics are not available
+   */
+  std::pair<int64_t, int64_t> filter_row_group_rows(filter_expression const &filter,
+                                                    size_type rg_idx,
+                                                    size_type src_idx,
+                                                    datasource *source) const
+  {
+    auto const row_group_rows = get_row_group(rg_idx, src_idx).num_rows;
+    auto const all_rows       = std::make_pair(int64_t{0}, row_group_rows);
+
+    struct page_index {
+      int schema_idx;
+      OffsetIndex offset_index;
+      ColumnIndex column_index;
+    };
+    std::map<std::string, page_index> page_indexes;
+    std::vector<int64_t> boundaries{row_group_rows};
+    for (auto const &name : filter.get_column_names()) {
+      if (page_indexes.count(name) != 0) { continue; }
+      page_index index;
+      index.schema_idx = find_leaf_schema_index(name);
+      // Pages of columns with repetition levels do not necessarily hold whole rows
+      if (get_schema(index.schema_idx).max_repetition_level > 0) { return all_rows; }
+      auto const &chunk = get_column_chunk(rg_idx, src_idx, index.schema_idx);
+      if (!read_page_index(
+            source, chunk.offset_index_offset, chunk.offset_index_length, &index.offset_index) ||
+          !is_valid_offset_index(index.offset_index, chunk.meta_data, row_group_rows) ||
+          !read_page_index(
+            source, chunk.column_index_offset, chunk.column_index_length, &index.column_index)) {
+        return all_rows;
+      }
+      auto const num_pages = index.offset_index.page_locations.size();
+      auto const &column_index = index.column_index;
+      if (column_index.null_pages.size() != num_pages ||
+          column_index.min_values.size() != num_pages ||
+          column_index.max_values.size() != num_pages) {
+        return all_rows;
+      }
+      for (auto const &page : index.offset_index.page_locations) {
+        boundaries.push_back(page.first_row_index);
+      }
+      page_indexes.emplace(name, std::move(index));
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+    // Evaluate the filter on each range of rows that lies within a single page of every column
+    int64_t first_row = row_group_rows;
+    int64_t end_row   = 0;
+    for (size_t i = 0; i + 1 < boundaries.size(); ++i) {
+      auto const range_start = boundaries[i];
+      auto const matches     = may_match(filter, [&](std::string const &name) {
+        auto const &index = page_indexes.at(name);
+        auto const &pages = index.offset_index.page_locations;
+        auto const page   = std::distance(
+                            pages.cbegin(),
+                            std::upper_bound(pages.cbegin(),
+                                             pages.cend(),
+                                             range_start,
+                                             [](int64_t row, PageLocation const &location) {
+                                               return row < location.first_row_index;
+                                             })) -
+                          1;
+        auto const page_end = (static_cast<size_t>(page) + 1 < pages.size())
+                                ? pages[page + 1].first_row_index
+                                : row_group_rows;
+        return decode_filter_statistics(index.column_index,
+                                        page,
+                                        page_end - pages[page].first_row_index,
+                                        get_schema(index.schema_idx));
+      });
+      if (matches) {
+        first_row = std::min(first_row, range_start);
+        end_row   = boundaries[i + 1];
+      }
+    }
+    return (first_row < end_row) ? std::make_pair(first_row, end_row)
+                                  : std::make_pair(int64_t{0}, int64_t{0});
   }
 
   auto get_num_rows() const { return num_rows; }
 
   auto get_num_row_groups() const { return num_row_groups; }
 
-  auto const &get_schema(int schema_idx) const { return per_file_metadata[0].schema[schema_idx]; }
+  auto const &get_schema(int schema_idx) const { return per_file_metadata[0]->schema[schema_idx]; }
 
   auto const &get_key_value_metadata() const { return agg_keyval_map; }
 
@@ -411,7 +883,7 @@ class aggregate_metadata {
    */
   inline int get_output_nesting_depth(int schema_index) const
   {
-    auto &pfm = per_file_metadata[0];
+    auto const &pfm = *per_file_metadata[0];
     int depth = 0;
 
     // walk upwards, skipping repeated fields
@@ -513,7 +985,7 @@ class aggregate_metadata {
         for (auto const &rowgroup_idx : row_groups[src_idx]) {
           CUDF_EXPECTS(
             rowgroup_idx >= 0 &&
-              rowgroup_idx < static_cast<size_type>(per_file_metadata[src_idx].row_groups.size()),
+              rowgroup_idx < static_cast<size_type>(per_file_metadata[src_idx]->row_groups.size()),
             "Invalid rowgroup index");
           selection.emplace_back(rowgroup_idx, row_count, src_idx);
           row_count += get_row_group(rowgroup_idx, src_idx).num_rows;
@@ -534,7 +1006,7 @@ class aggregate_metadata {
     std::vector<row_group_info> selection;
     size_type count = 0;
     for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
-      for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx].row_groups.size(); ++rg_idx) {
+      for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx]->row_groups.size(); ++rg_idx) {
         auto const chunk_start_row = count;
         count += get_row_group(rg_idx, src_idx).num_rows;
         if (count > row_start || count == 0) {
@@ -637,7 +1109,7 @@ class aggregate_metadata {
                       type_id timestamp_type_id,
                       bool strict_decimal_types) const
   {
-    auto const &pfm = per_file_metadata[0];
+    auto const &pfm = *per_file_metadata[0];
 
     // determine the list of output columns
     //
@@ -823,6 +1295,7 @@ void reader::impl::read_column_chunks(
   size_t begin_chunk,
   size_t end_chunk,
   const std::vector<size_t> &column_chunk_offsets,
+  std::vector<std::pair<size_t, size_t>> const &column_chunk_gaps,
   std::vector<size_type> const &chunk_source_map,
   rmm::cuda_stream_view stream)
 {
@@ -832,11 +1305,13 @@ void reader::impl::read_column_chunks(
     size_t io_size           = chunks[chunk].compressed_size;
     size_t next_chunk        = chunk + 1;
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
+    const auto &gap          = column_chunk_gaps[chunk];
+    while (gap.second == 0 && next_chunk < end_chunk) {
       const size_t next_offset = column_chunk_offsets[next_chunk];
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
+          column_chunk_gaps[next_chunk].second != 0) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
@@ -845,7 +1320,20 @@ void reader::impl::read_column_chunks(
       io_size += chunks[next_chunk].compressed_size;
       next_chunk++;
     }
-    if (io_size != 0) {
+    if (io_size != 0 && gap.second != 0) {
+      // Read the dictionary page and the selected data pages around the skipped data pages
+      auto const &source = _sources[chunk_source_map[chunk]];
+      std::vector<uint8_t> buffer(io_size);
+      auto const tail_size = io_size - gap.first;
+      CUDF_EXPECTS(source->host_read(io_offset, gap.first, buffer.data()) == gap.first &&
+                     source->host_read(io_offset + gap.first + gap.second,
+                                       tail_size,
+                                       buffer.data() + gap.first) == tail_size,
+                   "Unexpected end of file while reading column chunk data");
+      page_data[chunk]              = rmm::device_buffer(buffer.data(), buffer.size(), stream);
+      chunks[chunk].compressed_data = static_cast<uint8_t *>(page_data[chunk].data());
+      chunk                         = next_chunk;
+    } else if (io_size != 0) {
       auto buffer         = _sources[chunk_source_map[chunk]]->host_read(io_offset, io_size);
       page_data[chunk]    = rmm::device_buffer(buffer->data(), buffer->size(), stream);
       uint8_t *d_compdata = static_cast<uint8_t *>(page_data[chunk].data());
@@ -922,9 +1410,13 @@ rmm::device_buffer reader::impl::decompress_page_data(
   // Count the exact number of compressed pages
   size_t num_comp_pages    = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{std::make_pair(parquet::GZIP, 0),
-                                                                std::make_pair(parquet::SNAPPY, 0),
-                                                                std::make_pair(parquet::BROTLI, 0)};
+  std::array<std::pair<parquet::Compression, size_t>, 6> codecs{
+    std::make_pair(parquet::GZIP, 0),
+    std::make_pair(parquet::SNAPPY, 0),
+    std::make_pair(parquet::BROTLI, 0),
+    std::make_pair(parquet::ZSTD, 0),
+    std::make_pair(parquet::LZ4, 0),
+    std::make_pair(parquet::LZ4_RAW, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
@@ -942,6 +1434,10 @@ rmm::device_buffer reader::impl::decompress_page_data(
   hostdevice_vector<gpu_inflate_input_s> inflate_in(0, num_comp_pages, stream);
   hostdevice_vector<gpu_inflate_status_s> inflate_out(0, num_comp_pages, stream);
 
+  // GZIP and SNAPPY pages may also be decompressed on the host; BROTLI pages are only decompressed
+  // on the device
+  const bool on_host = prefer_host_decompression();
+
   size_t decomp_offset = 0;
   int32_t argc         = 0;
   for (const auto &codec : codecs) {
@@ -976,17 +1472,33 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                stream.value()));
       switch (codec.first) {
         case parquet::GZIP:
-          CUDA_TRY(gpuinflate(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos,
-                              1,
-                              stream))
+          if (on_host) {
+            host_decompress_device(IO_UNCOMP_STREAM_TYPE_GZIP,
+                                   inflate_in.device_ptr(start_pos),
+                                   inflate_out.device_ptr(start_pos),
+                                   argc - start_pos,
+                                   stream);
+          } else {
+            CUDA_TRY(gpuinflate(inflate_in.device_ptr(start_pos),
+                                inflate_out.device_ptr(start_pos),
+                                argc - start_pos,
+                                1,
+                                stream))
+          }
           break;
         case parquet::SNAPPY:
-          CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos,
-                              stream));
+          if (on_host) {
+            host_decompress_device(IO_UNCOMP_STREAM_TYPE_SNAPPY,
+                                   inflate_in.device_ptr(start_pos),
+                                   inflate_out.device_ptr(start_pos),
+                                   argc - start_pos,
+                                   stream);
+          } else {
+            CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(start_pos),
+                                inflate_out.device_ptr(start_pos),
+                                argc - start_pos,
+                                stream));
+          }
           break;
         case parquet::BROTLI:
           CUDA_TRY(gpu_debrotli(inflate_in.device_ptr(start_pos),
@@ -996,6 +1508,29 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                 argc - start_pos,
                                 stream));
           break;
+        // No device decoders; the pages are decompressed on the host
+        case parquet::ZSTD:
+          host_decompress_device(IO_UNCOMP_STREAM_TYPE_ZSTD,
+                                 inflate_in.device_ptr(start_pos),
+                                 inflate_out.device_ptr(start_pos),
+                                 argc - start_pos,
+                                 stream);
+          break;
+        case parquet::LZ4:
+          // Hadoop-framed LZ4, as written by parquet-mr; raw blocks are accepted as well
+          host_decompress_device(IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP,
+                                 inflate_in.device_ptr(start_pos),
+                                 inflate_out.device_ptr(start_pos),
+                                 argc - start_pos,
+                                 stream);
+          break;
+        case parquet::LZ4_RAW:
+          host_decompress_device(IO_UNCOMP_STREAM_TYPE_LZ4,
+                                 inflate_in.device_ptr(start_pos),
+                                 inflate_out.device_ptr(start_pos),
+                                 argc - start_pos,
+                                 stream);
+          break;
         default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
       }
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
@@ -1351,8 +1886,21 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr), _sources(std::move(sources))
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_metadata>(_sources);
+  // Sources are only cached if they can be identified
+  std::vector<std::string> cache_keys;
+  if (options.is_enabled_use_metadata_cache()) {
+    cache_keys = options.get_metadata_cache_keys();
+    if (cache_keys.empty() && options.get_source().type == io_type::FILEPATH) {
+      auto const &filepaths = options.get_source().filepaths;
+      std::transform(
+        filepaths.cbegin(), filepaths.cend(), std::back_inserter(cache_keys), file_cache_key);
+    }
+  }
+
+  // Open and parse the source dataset metadata; with an explicit column selection, only the
+  // metadata of the selected column chunks is decoded
+  auto const defer_column_chunks = !options.get_columns().empty();
+  _metadata = std::make_unique<aggregate_metadata>(_sources, cache_keys, defer_column_chunks);
 
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -1361,6 +1909,8 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
 
   _strict_decimal_types = options.is_enabled_strict_decimal_types();
 
+  _filter = options.get_filter();
+
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
 
@@ -1371,6 +1921,21 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
                               _strings_to_categorical,
                               _timestamp_type.id(),
                               _strict_decimal_types);
+
+  std::vector<int> selected_schema_indices;
+  std::transform(_input_columns.cbegin(),
+                 _input_columns.cend(),
+                 std::back_inserter(selected_schema_indices),
+                 [](auto const &col) { return col.schema_idx; });
+  // The statistics of the filtered columns are needed as well
+  for (auto const &name : _filter.get_column_names()) {
+    selected_schema_indices.push_back(_metadata->find_leaf_schema_index(name));
+  }
+  std::sort(selected_schema_indices.begin(), selected_schema_indices.end());
+  selected_schema_indices.erase(
+    std::unique(selected_schema_indices.begin(), selected_schema_indices.end()),
+    selected_schema_indices.end());
+  _metadata->decode_column_chunks(selected_schema_indices);
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
@@ -1378,9 +1943,34 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                        std::vector<std::vector<size_type>> const &row_group_list,
                                        rmm::cuda_stream_view stream)
 {
+  // Skip the row groups that cannot contain rows that match the filter
+  std::vector<std::vector<size_type>> filtered_row_groups;
+  if (not _filter.matches_all()) {
+    CUDF_EXPECTS(skip_rows == 0 && num_rows == -1,
+                 "skip_rows and num_rows can't be combined with a filter");
+    filtered_row_groups = _metadata->filter_row_groups(_filter, row_group_list);
+  }
+
   // Select only row groups required
-  const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+  const auto selected_row_groups = _metadata->select_row_groups(
+    _filter.matches_all() ? row_group_list : filtered_row_groups, skip_rows, num_rows);
+
+  // Narrow the rows down to the pages whose statistics show that they may contain matching rows
+  if (not _filter.matches_all()) {
+    int64_t filtered_start = std::numeric_limits<int64_t>::max();
+    int64_t filtered_end   = 0;
+    for (auto const &rg : selected_row_groups) {
+      auto const rows = _metadata->filter_row_group_rows(
+        _filter, rg.index, rg.source_index, _sources[rg.source_index].get());
+      if (rows.first < rows.second) {
+        filtered_start = std::min<int64_t>(filtered_start, rg.start_row + rows.first);
+        filtered_end   = std::max<int64_t>(filtered_end, rg.start_row + rows.second);
+      }
+    }
+    skip_rows = static_cast<size_type>((filtered_start < filtered_end) ? filtered_start : 0);
+    num_rows =
+      static_cast<size_type>((filtered_start < filtered_end) ? filtered_end - filtered_start : 0);
+  }
 
   table_metadata out_metadata;
 
@@ -1400,25 +1990,90 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> page_data(num_chunks);
 
-    // Keep track of column chunk file offsets
+    // Keep track of column chunk file offsets, and of the data pages skipped within the chunks
     std::vector<size_t> column_chunk_offsets(num_chunks);
+    std::vector<std::pair<size_t, size_t>> column_chunk_gaps(num_chunks);
 
     // if there are lists present, we need to preprocess
     bool has_lists = false;
 
+    // Select the parts of the column chunks to read. Row groups outside of the rows to read are
+    // skipped, and of the columns without repetition levels only the data pages that overlap the
+    // rows to read are read, if the column chunks have an offset index
+    std::vector<chunk_read_range> read_ranges;
+    read_ranges.reserve(num_chunks);
+    // End of the rows to read of each row group, relative to the row group
+    std::vector<int64_t> row_group_end_rows;
+    row_group_end_rows.reserve(selected_row_groups.size());
+    for (const auto &rg : selected_row_groups) {
+      const auto &row_group = _metadata->get_row_group(rg.index, rg.source_index);
+      auto const first_row  = std::max<int64_t>(skip_rows - static_cast<int64_t>(rg.start_row), 0);
+      auto const end_row =
+        std::min<int64_t>(skip_rows + num_rows - static_cast<int64_t>(rg.start_row),
+                          row_group.num_rows);
+      row_group_end_rows.push_back(std::max<int64_t>(end_row, 0));
+      for (const auto &col : _input_columns) {
+        auto const &chunk = _metadata->get_column_chunk(rg.index, rg.source_index, col.schema_idx);
+        chunk_read_range range;
+        range.offset = column_chunk_offset(chunk.meta_data);
+        range.size   = chunk.meta_data.total_compressed_size;
+        if (row_group.num_rows != 0 && first_row >= end_row) {
+          range.num_rows = 0;
+        } else if ((first_row > 0 || end_row < row_group.num_rows) &&
+                   _metadata->get_schema(col.schema_idx).max_repetition_level == 0) {
+          OffsetIndex offset_index;
+          if (read_page_index(_sources[rg.source_index].get(),
+                              chunk.offset_index_offset,
+                              chunk.offset_index_length,
+                              &offset_index) &&
+              is_valid_offset_index(offset_index, chunk.meta_data, row_group.num_rows)) {
+            range =
+              select_pages(chunk.meta_data, offset_index, row_group.num_rows, first_row, end_row);
+          }
+        }
+        read_ranges.push_back(range);
+      }
+    }
+
+    // Let the sources know about all column chunk reads up front, so that fetching the data of
+    // later column chunks can overlap with the transfer of the earlier ones to the device. The
+    // chunks are all read before any of them is decoded, so decoding does not overlap with I/O.
+    std::vector<std::vector<std::pair<size_t, size_t>>> source_read_ranges(_sources.size());
+    for (size_t r = 0; r < read_ranges.size(); ++r) {
+      auto const &range = read_ranges[r];
+      if (range.num_rows == 0) { continue; }
+      auto &ranges = source_read_ranges[selected_row_groups[r / num_input_columns].source_index];
+      if (range.gap_size == 0) {
+        ranges.emplace_back(range.offset, range.size);
+      } else {
+        ranges.emplace_back(range.offset, range.gap_start);
+        ranges.emplace_back(range.offset + range.gap_start + range.gap_size,
+                            range.size - range.gap_start);
+      }
+    }
+    for (size_t src_idx = 0; src_idx < _sources.size(); ++src_idx) {
+      if (not source_read_ranges[src_idx].empty()) {
+        _sources[src_idx]->prefetch(source_read_ranges[src_idx]);
+      }
+    }
+
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
-    auto remaining_rows            = num_rows;
-    for (const auto &rg : selected_row_groups) {
-      const auto &row_group       = _metadata->get_row_group(rg.index, rg.source_index);
+    for (size_t rg_pos = 0; rg_pos < selected_row_groups.size(); ++rg_pos) {
+      const auto &rg              = selected_row_groups[rg_pos];
       auto const row_group_start  = rg.start_row;
       auto const row_group_source = rg.source_index;
-      auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
+      // Whole chunks are decoded from the start of the row group to the last row to read
+      auto const row_group_rows   = static_cast<size_type>(row_group_end_rows[rg_pos]);
       auto const io_chunk_idx     = chunks.size();
 
       // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
       for (size_t i = 0; i < num_input_columns; ++i) {
-        auto col = _input_columns[i];
+        auto col          = _input_columns[i];
+        auto const &range = read_ranges[rg_pos * num_input_columns + i];
+        // The row group does not overlap the rows to read
+        if (range.num_rows == 0) { continue; }
+
         // look up metadata
         auto &col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
         auto &schema   = _metadata->get_schema(col.schema_idx);
@@ -1444,18 +2099,18 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           schema.converted_type,
           schema.type_length);
 
-        column_chunk_offsets[chunks.size()] =
-          (col_meta.dictionary_page_offset != 0)
-            ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
-            : col_meta.data_page_offset;
+        // Without repetition levels, each row of the selected data pages holds one value
+        auto const is_whole_chunk           = (range.num_rows < 0);
+        column_chunk_offsets[chunks.size()] = range.offset;
+        column_chunk_gaps[chunks.size()]    = std::make_pair(range.gap_start, range.gap_size);
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        chunks.insert(gpu::ColumnChunkDesc(range.size,
                                            nullptr,
-                                           col_meta.num_values,
+                                           is_whole_chunk ? col_meta.num_values : range.num_rows,
                                            schema.type,
                                            type_width,
-                                           row_group_start,
-                                           row_group_rows,
+                                           row_group_start + range.first_row,
+                                           is_whole_chunk ? row_group_rows : range.num_rows,
                                            schema.max_definition_level,
                                            schema.max_repetition_level,
                                            _metadata->get_output_nesting_depth(col.schema_idx),
@@ -1481,15 +2136,13 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                          io_chunk_idx,
                          chunks.size(),
                          column_chunk_offsets,
+                         column_chunk_gaps,
                          chunk_source_map,
                          stream);
-
-      remaining_rows -= row_group.num_rows;
     }
-    assert(remaining_rows <= 0);
 
     // Process dataset chunk pages into output columns
-    const auto total_pages = count_page_headers(chunks, stream);
+    const auto total_pages = (chunks.size() != 0) ? count_page_headers(chunks, stream) : 0;
     if (total_pages > 0) {
       hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, stream);
       rmm::device_buffer decomp_page_data;
@@ -1573,7 +2226,11 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 reader::reader(std::vector<std::string> const &filepaths,
                parquet_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepaths), options, mr))
+  : _impl(std::make_unique<impl>(
+      cudf::io::detail::make_prefetching_sources(
+        datasource::create(filepaths, options.get_source().read_mode)),
+      options,
+      mr))
 {
 }
 
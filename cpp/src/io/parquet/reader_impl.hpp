@@ -88,6 +88,8 @@ class reader::impl {
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
    * @param column_chunk_offsets File offset for all chunks
+   * @param column_chunk_gaps Skipped data pages of each chunk, as the offset within the chunk
+   * data and the number of skipped bytes
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    */
@@ -96,6 +98,7 @@ class reader::impl {
                           size_t begin_chunk,
                           size_t end_chunk,
                           const std::vector<size_t> &column_chunk_offsets,
+                          std::vector<std::pair<size_t, size_t>> const &column_chunk_gaps,
                           std::vector<size_type> const &chunk_source_map,
                           rmm::cuda_stream_view stream);
 
@@ -211,6 +214,7 @@ class reader::impl {
   bool _strings_to_categorical = false;
   data_type _timestamp_type{type_id::EMPTY};
   bool _strict_decimal_types = false;
+  filter_expression _filter;
 };
 
 }  // namespace parquet
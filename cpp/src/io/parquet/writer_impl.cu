@@ -21,6 +21,7 @@
 
 #include "writer_impl.hpp"
 
+#include <io/comp/io_uncomp.h>
 #include <io/parquet/compact_protocol_writer.hpp>
 
 #include <cudf/column/column_device_view.cuh>
@@ -61,6 +62,8 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::ZSTD: return parquet::Compression::ZSTD;
+    case compression_type::LZ4: return parquet::Compression::LZ4_RAW;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -610,6 +613,13 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
     case parquet::Compression::SNAPPY:
       CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
       break;
+    // No device encoders; the pages are compressed on the host
+    case parquet::Compression::ZSTD:
+      host_compress_device(IO_UNCOMP_STREAM_TYPE_ZSTD, comp_in, comp_out, pages_in_batch, stream);
+      break;
+    case parquet::Compression::LZ4_RAW:
+      host_compress_device(IO_UNCOMP_STREAM_TYPE_LZ4, comp_in, comp_out, pages_in_batch, stream);
+      break;
     default: break;
   }
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
@@ -1120,6 +1130,13 @@ void writer::impl::write_chunk(table_view const &table, pq_chunked_state &state)
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data().get() + num_pages
                                                                : nullptr,
       state.stream);
+    // The (compressed) size of the encoded chunks is known once the batch is encoded; lets
+    // in-memory sinks allocate their output ahead of the writes
+    size_t batch_size = 0;
+    for (auto c = r * num_columns; c < rnext * num_columns; c++) {
+      batch_size += chunks[c].compressed_size;
+    }
+    out_sink_->set_expected_size(out_sink_->bytes_written() + batch_size);
     for (; r < rnext; r++, global_r++) {
       for (auto i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
@@ -14,41 +14,226 @@
  * limitations under the License.
  */
 
-#include <fstream>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <vector>
+
 namespace cudf {
 namespace io {
 /**
  * @brief Implementation class for storing data into a local file.
+ *
+ * Small writes are accumulated into large aligned buffers. Two buffers are used: while one is
+ * filled by `host_write()`, the other is written to the file on a background thread, so that the
+ * caller only blocks on the disk when it produces data faster than the disk absorbs it. Writes
+ * larger than a buffer are written directly from the caller's memory, together with the
+ * buffered data, using a single `pwritev()`.
  */
 class file_sink : public data_sink {
+  static constexpr size_t buffer_size      = 8 * 1024 * 1024;
+  static constexpr size_t buffer_alignment = 4096;
+
+  struct aligned_deleter {
+    void operator()(uint8_t* ptr) const { std::free(ptr); }
+  };
+  using aligned_buffer = std::unique_ptr<uint8_t, aligned_deleter>;
+
+  static aligned_buffer make_aligned_buffer()
+  {
+    void* ptr = nullptr;
+    CUDF_EXPECTS(posix_memalign(&ptr, buffer_alignment, buffer_size) == 0,
+                 "Cannot allocate output buffer");
+    return aligned_buffer(static_cast<uint8_t*>(ptr));
+  }
+
  public:
-  explicit file_sink(std::string const& filepath)
+  explicit file_sink(std::string const& filepath, file_sync_policy sync_policy)
+    : fd_(open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666)),
+      sync_policy_(sync_policy),
+      active_(make_aligned_buffer()),
+      background_(make_aligned_buffer())
   {
-    outfile_.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
-    CUDF_EXPECTS(outfile_.is_open(), "Cannot open output file");
+    CUDF_EXPECTS(fd_ != -1, "Cannot open output file");
   }
 
-  virtual ~file_sink() { flush(); }
+  virtual ~file_sink()
+  {
+    // Destructors cannot report errors; callers that need to know call flush() explicitly
+    try {
+      flush();
+      if (sync_policy_ == file_sync_policy::ON_CLOSE) { fsync(fd_); }
+    } catch (...) {
+    }
+    close(fd_);
+  }
 
   void host_write(void const* data, size_t size) override
   {
-    outfile_.write(static_cast<char const*>(data), size);
+    auto src = static_cast<uint8_t const*>(data);
+
+    if (size >= buffer_size) {
+      // Write large pieces directly, along with the buffered data to preserve the ordering
+      wait_for_background_write();
+      std::vector<iovec> iov;
+      if (active_size_ != 0) { iov.push_back({active_.get(), active_size_}); }
+      iov.push_back({const_cast<uint8_t*>(src), size});
+      write_all(fd_, std::move(iov), file_offset_);
+      file_offset_ += active_size_ + size;
+      active_size_ = 0;
+      return;
+    }
+
+    while (size > 0) {
+      auto const len = std::min(size, buffer_size - active_size_);
+      std::memcpy(active_.get() + active_size_, src, len);
+      active_size_ += len;
+      src += len;
+      size -= len;
+      if (active_size_ == buffer_size) { submit_active_buffer(); }
+    }
   }
 
-  void flush() override { outfile_.flush(); }
+  void flush() override
+  {
+    if (active_size_ != 0) { submit_active_buffer(); }
+    wait_for_background_write();
+    if (sync_policy_ == file_sync_policy::ON_FLUSH) {
+      CUDF_EXPECTS(fsync(fd_) == 0, "Cannot sync output file");
+    }
+  }
 
-  size_t bytes_written() override { return outfile_.tellp(); }
+  size_t bytes_written() override { return file_offset_ + active_size_; }
 
  private:
-  std::ofstream outfile_;
+  /**
+   * @brief Writes all data described by `iov` at the given file offset, resuming partial writes.
+   */
+  static void write_all(int fd, std::vector<iovec> iov, size_t offset)
+  {
+    size_t first = 0;
+    while (first < iov.size()) {
+      auto const written = pwritev(fd, iov.data() + first, iov.size() - first, offset);
+      if (written == -1 && errno == EINTR) { continue; }
+      CUDF_EXPECTS(written > 0, "Cannot write to output file");
+      offset += written;
+
+      // Skip over the fully written entries and advance into the partially written one
+      auto remaining = static_cast<size_t>(written);
+      while (first < iov.size() && remaining >= iov[first].iov_len) {
+        remaining -= iov[first].iov_len;
+        ++first;
+      }
+      if (remaining != 0) {
+        iov[first].iov_base = static_cast<uint8_t*>(iov[first].iov_base) + remaining;
+        iov[first].iov_len -= remaining;
+      }
+    }
+  }
+
+  /**
+   * @brief Hands the active buffer to the background writer and continues with the other one.
+   */
+  void submit_active_buffer()
+  {
+    // The other buffer can only be reused once its write has completed
+    wait_for_background_write();
+    std::swap(active_, background_);
+
+    auto const fd     = fd_;
+    auto const data   = background_.get();
+    auto const size   = active_size_;
+    auto const offset = file_offset_;
+    pending_write_    = writer_.submit([fd, data, size, offset] {
+      write_all(fd, {{data, size}}, offset);
+    });
+    file_offset_ += active_size_;
+    active_size_ = 0;
+  }
+
+  /**
+   * @brief Waits for the background write, rethrowing any error it encountered.
+   */
+  void wait_for_background_write()
+  {
+    if (pending_write_.valid()) { pending_write_.get(); }
+  }
+
+  int const fd_;
+  file_sync_policy const sync_policy_;
+  aligned_buffer active_;      ///< Buffer being filled by `host_write()`
+  aligned_buffer background_;  ///< Buffer being written by the background writer
+  size_t active_size_ = 0;
+  size_t file_offset_ = 0;     ///< File offset of the start of the active buffer
+  std::future<void> pending_write_;
+  detail::thread_pool writer_{1};
 };
 
+chunked_host_buffer::chunked_host_buffer(size_t chunk_size) : chunk_size_(chunk_size)
+{
+  CUDF_EXPECTS(chunk_size_ > 0, "Chunk size must be positive");
+}
+
+void chunked_host_buffer::append(void const* data, size_t size)
+{
+  auto src = static_cast<char const*>(data);
+  while (size > 0) {
+    auto const chunk_pos = size_ % chunk_size_;
+    auto const chunk_idx = size_ / chunk_size_;
+    if (chunk_idx == chunks_.size()) { chunks_.emplace_back(new char[chunk_size_]); }
+    auto const copy_size = std::min(size, chunk_size_ - chunk_pos);
+    std::memcpy(chunks_[chunk_idx].get() + chunk_pos, src, copy_size);
+    src += copy_size;
+    size -= copy_size;
+    size_ += copy_size;
+  }
+}
+
+void chunked_host_buffer::reserve(size_t size)
+{
+  while (chunks_.size() * chunk_size_ < size) { chunks_.emplace_back(new char[chunk_size_]); }
+}
+
+std::vector<host_buffer> chunked_host_buffer::chunks() const
+{
+  std::vector<host_buffer> views;
+  for (size_t offset = 0; offset < size_; offset += chunk_size_) {
+    views.emplace_back(chunks_[offset / chunk_size_].get(), std::min(chunk_size_, size_ - offset));
+  }
+  return views;
+}
+
+std::vector<char> chunked_host_buffer::flatten() const
+{
+  std::vector<char> flat;
+  flat.reserve(size_);
+  for (auto const& chunk : chunks()) {
+    flat.insert(flat.end(), chunk.data, chunk.data + chunk.size);
+  }
+  return flat;
+}
+
+void chunked_host_buffer::clear()
+{
+  chunks_.clear();
+  size_ = 0;
+}
+
 /**
  * @brief Implementation class for storing data into a std::vector.
  */
@@ -60,18 +245,52 @@ class host_buffer_sink : public data_sink {
 
   void host_write(void const* data, size_t size) override
   {
+    reserve(buffer_->size() + size);
     auto char_array = static_cast<char const*>(data);
     buffer_->insert(buffer_->end(), char_array, char_array + size);
   }
 
+  void set_expected_size(size_t size) override { reserve(size); }
+
   void flush() override {}
 
   size_t bytes_written() override { return buffer_->size(); }
 
  private:
+  /**
+   * @brief Grows the capacity of the vector to at least `size`, at least doubling it so that the
+   * data written so far is only copied a few times, even if the expected size keeps being refined.
+   */
+  void reserve(size_t size)
+  {
+    if (size <= buffer_->capacity()) { return; }
+    buffer_->reserve(std::max(size, 2 * buffer_->capacity()));
+  }
+
   std::vector<char>* buffer_;
 };
 
+/**
+ * @brief Implementation class for storing data into a chunked host buffer
+ */
+class chunked_host_buffer_sink : public data_sink {
+ public:
+  explicit chunked_host_buffer_sink(chunked_host_buffer* buffer) : buffer_(buffer) {}
+
+  virtual ~chunked_host_buffer_sink() {}
+
+  void host_write(void const* data, size_t size) override { buffer_->append(data, size); }
+
+  void set_expected_size(size_t size) override { buffer_->reserve(size); }
+
+  void flush() override {}
+
+  size_t bytes_written() override { return buffer_->size(); }
+
+ private:
+  chunked_host_buffer* buffer_;
+};
+
 /**
  * @brief Implementation class for voiding data (no io performed)
  */
@@ -123,9 +342,10 @@ class user_sink_wrapper : public data_sink {
   cudf::io::data_sink* const user_sink;
 };
 
-std::unique_ptr<data_sink> data_sink::create(const std::string& filepath)
+std::unique_ptr<data_sink> data_sink::create(const std::string& filepath,
+                                             file_sync_policy sync_policy)
 {
-  return std::make_unique<file_sink>(filepath);
+  return std::make_unique<file_sink>(filepath, sync_policy);
 }
 
 std::unique_ptr<data_sink> data_sink::create(std::vector<char>* buffer)
@@ -133,6 +353,11 @@ std::unique_ptr<data_sink> data_sink::create(std::vector<char>* buffer)
   return std::make_unique<host_buffer_sink>(buffer);
 }
 
+std::unique_ptr<data_sink> data_sink::create(chunked_host_buffer* buffer)
+{
+  return std::make_unique<chunked_host_buffer_sink>(buffer);
+}
+
 std::unique_ptr<data_sink> data_sink::create() { return std::make_unique<void_sink>(); }
 
 std::unique_ptr<data_sink> data_sink::create(cudf::io::data_sink* const user_sink)
@@ -20,111 +20,384 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <io/utilities/thread_pool.hpp>
+
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <list>
+#include <mutex>
+#include <string>
+
 namespace cudf {
 namespace io {
+namespace {
+/**
+ * @brief Resolves `file_read_mode::AUTO` using the `LIBCUDF_FILE_READ_MODE` environment variable.
+ */
+file_read_mode resolve_read_mode(file_read_mode mode)
+{
+  if (mode != file_read_mode::AUTO) { return mode; }
+
+  auto const env = std::getenv("LIBCUDF_FILE_READ_MODE");
+  if (env == nullptr) { return file_read_mode::MEMORY_MAPPED; }
+  auto const value = std::string(env);
+  if (value == "MEMORY_MAPPED") { return file_read_mode::MEMORY_MAPPED; }
+  if (value == "POSITIONAL") { return file_read_mode::POSITIONAL; }
+  if (value == "DIRECT") { return file_read_mode::DIRECT; }
+  CUDF_FAIL("Invalid LIBCUDF_FILE_READ_MODE value: " + value);
+}
+
+/**
+ * @brief Read-only file descriptor, closed on destruction.
+ */
+class file_descriptor {
+ public:
+  file_descriptor(const char *filepath, int flags) : fd_(open(filepath, flags)) {}
+  ~file_descriptor()
+  {
+    if (fd_ != -1) { close(fd_); }
+  }
+  file_descriptor(file_descriptor const &) = delete;
+  file_descriptor &operator=(file_descriptor const &) = delete;
+
+  int get() const { return fd_; }
+
+  /**
+   * @brief Returns the size of the file.
+   */
+  size_t file_size() const
+  {
+    struct stat st;
+    CUDF_EXPECTS(fstat(fd_, &st) != -1, "Cannot query file size");
+    return static_cast<size_t>(st.st_size);
+  }
+
+ private:
+  int const fd_;
+};
+
+}  // namespace
 
 /**
  * @brief Implementation class for reading from a file or memory source using
  * memory mapped access.
  *
- * Unlike Arrow's memory mapped IO class, this implementation allows memory
- * mapping a subset of the file where the starting offset may not be zero.
+ * Unlike Arrow's memory mapped IO class, this implementation maps windows of the file on demand
+ * instead of the entire file. Mapped windows are cached and reused by subsequent reads; when the
+ * total size of the cached windows exceeds a limit, the least recently used windows are unmapped.
+ * A window stays mapped for as long as any buffer returned by `host_read()` references it.
+ *
+ * Small reads (e.g. metadata) are advised as random access to avoid read-ahead of unrelated data,
+ * while large reads are advised as sequential access and prefetched.
+ *
+ * Reads are limited to the range of the file given on creation.
  */
 class memory_mapped_source : public datasource {
-  struct file_wrapper {
-    const int fd = -1;
-    explicit file_wrapper(const char *filepath) : fd(open(filepath, O_RDONLY)) {}
-    ~file_wrapper() { close(fd); }
+  static constexpr size_t min_window_size          = 64 * 1024 * 1024;
+  static constexpr size_t max_mapped_bytes         = 4ul * 1024 * 1024 * 1024;
+  static constexpr size_t sequential_read_min_size = 1024 * 1024;
+
+  /**
+   * @brief A mapped window of the file; unmapped on destruction.
+   */
+  struct mapped_window {
+    void *addr    = nullptr;
+    size_t offset = 0;
+    size_t size   = 0;
+    mapped_window(void *addr, size_t offset, size_t size) : addr(addr), offset(offset), size(size)
+    {
+    }
+    ~mapped_window() { munmap(addr, size); }
+    bool contains(size_t pos, size_t len) const
+    {
+      return pos >= offset && pos + len <= offset + size;
+    }
+    uint8_t *data_at(size_t pos) const { return static_cast<uint8_t *>(addr) + (pos - offset); }
   };
 
   class memory_mapped_buffer : public buffer {
-    size_t _size   = 0;
+    std::shared_ptr<mapped_window> _window;
     uint8_t *_data = nullptr;
+    size_t _size   = 0;
 
    public:
-    memory_mapped_buffer(uint8_t *data, size_t size) : _data(data), _size(size) {}
+    memory_mapped_buffer(std::shared_ptr<mapped_window> window, uint8_t *data, size_t size)
+      : _window(std::move(window)), _data(data), _size(size)
+    {
+    }
     size_t size() const override { return _size; }
     const uint8_t *data() const override { return _data; }
   };
 
  public:
   explicit memory_mapped_source(const char *filepath, size_t offset, size_t size)
+    : file_(filepath, O_RDONLY)
   {
-    auto const file = file_wrapper(filepath);
-    CUDF_EXPECTS(file.fd != -1, "Cannot open file");
+    CUDF_EXPECTS(file_.get() != -1, "Cannot open file");
+    file_size_ = file_.file_size();
+    // Nothing is mapped until the data is read
+    CUDF_EXPECTS(file_size_ == 0 || offset < file_size_, "Offset is past end of file");
+    range_offset_ = offset;
+    range_end_    = (size == 0) ? file_size_ : std::min(file_size_, offset + size);
+  }
 
-    struct stat st;
-    CUDF_EXPECTS(fstat(file.fd, &st) != -1, "Cannot query file size");
-    file_size_ = static_cast<size_t>(st.st_size);
+  // The windows must be unmapped before the file is closed
+  virtual ~memory_mapped_source() { windows_.clear(); }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const read_size = clamped_size(offset, size);
+    if (read_size == 0) { return std::make_unique<non_owning_buffer>(); }
 
-    if (file_size_ != 0) { map(file.fd, offset, size); }
+    auto const window = get_window(offset, read_size);
+    return std::make_unique<memory_mapped_buffer>(window, window->data_at(offset), read_size);
   }
 
-  virtual ~memory_mapped_source()
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override
   {
-    if (map_addr_ != nullptr) { munmap(map_addr_, map_size_); }
+    auto const read_size = clamped_size(offset, size);
+    if (read_size == 0) { return 0; }
+
+    auto const window = get_window(offset, read_size);
+    std::memcpy(dst, window->data_at(offset), read_size);
+    return read_size;
   }
 
-  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  bool supports_zero_copy_host_read() const override { return true; }
+
+  size_t size() const override { return file_size_; }
+
+ private:
+  /**
+   * @brief Clamps the size of a read to the range of the file given on creation.
+   */
+  size_t clamped_size(size_t offset, size_t size) const
   {
-    CUDF_EXPECTS(offset >= map_offset_, "Requested offset is outside mapping");
+    CUDF_EXPECTS(offset >= range_offset_, "Requested offset is outside mapping");
+    return (offset < range_end_) ? std::min(size, range_end_ - offset) : 0;
+  }
 
-    // Clamp length to available data in the mapped region
-    auto const read_size = std::min(size, map_size_ - (offset - map_offset_));
+  /**
+   * @brief Returns a mapped window that contains the given range, mapping one if needed.
+   */
+  std::shared_ptr<mapped_window> get_window(size_t offset, size_t size)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = std::find_if(windows_.begin(), windows_.end(), [&](auto const &window) {
+      return window->contains(offset, size);
+    });
+    std::shared_ptr<mapped_window> window;
+    if (it != windows_.end()) {
+      // Move to the front of the LRU list
+      window = *it;
+      windows_.erase(it);
+      windows_.push_front(window);
+    } else {
+      window = map(offset, std::max(size, std::min(min_window_size, range_end_ - offset)), size);
+    }
 
-    return std::make_unique<memory_mapped_buffer>(
-      static_cast<uint8_t *>(map_addr_) + (offset - map_offset_), read_size);
+    if (size >= sequential_read_min_size) {
+      // Start reading in the data that is about to be accessed
+      auto const page_offset = offset & ~(page_size_ - 1);
+      madvise(window->data_at(page_offset), size + (offset - page_offset), MADV_WILLNEED);
+    }
+    return window;
+  }
+
+  /**
+   * @brief Maps a window that contains the given range and adds it to the cache.
+   *
+   * The access pattern advised for the window depends on the size of the read that requires it,
+   * rather than on the size of the window.
+   *
+   * Must be called with `mutex_` held.
+   */
+  std::shared_ptr<mapped_window> map(size_t offset, size_t size, size_t read_size)
+  {
+    // Offset for `mmap()` must be page aligned
+    auto const map_offset = offset & ~(page_size_ - 1);
+
+    // Size for `mmap()` needs to include the page padding
+    auto const map_size = size + (offset - map_offset);
+
+    auto const addr = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, file_.get(), map_offset);
+    CUDF_EXPECTS(addr != MAP_FAILED, "Cannot create memory mapping");
+    auto window = std::make_shared<mapped_window>(addr, map_offset, map_size);
+    madvise(
+      addr, map_size, (read_size >= sequential_read_min_size) ? MADV_SEQUENTIAL : MADV_RANDOM);
+
+    // Evict the least recently used windows to stay within the limit; a window that is still
+    // referenced by a buffer is unmapped once the buffer is released
+    mapped_bytes_ += map_size;
+    while (not windows_.empty() && mapped_bytes_ > max_mapped_bytes) {
+      mapped_bytes_ -= windows_.back()->size;
+      windows_.pop_back();
+    }
+    windows_.push_front(window);
+    return window;
+  }
+
+ private:
+  file_descriptor const file_;
+  size_t const page_size_  = sysconf(_SC_PAGESIZE);
+  size_t file_size_        = 0;
+  size_t range_offset_     = 0;  ///< Start of the readable range
+  size_t range_end_        = 0;  ///< End of the readable range
+  size_t mapped_bytes_     = 0;
+  std::mutex mutex_;
+  std::list<std::shared_ptr<mapped_window>> windows_;  ///< Most recently used first
+};
+
+constexpr size_t memory_mapped_source::min_window_size;
+
+/**
+ * @brief Implementation class for reading from a file with positional reads.
+ *
+ * Data is read with `pread()` directly into the caller's buffer, avoiding the page faults and the
+ * additional copy of the memory mapped access. Large reads are split into several requests that
+ * are kept in flight concurrently.
+ *
+ * In direct mode the file is opened with `O_DIRECT` to bypass the page cache. Reads are then
+ * performed in aligned blocks through aligned bounce buffers, unless the destination, offset and
+ * size are already suitably aligned. If the file system does not support `O_DIRECT`, the source
+ * falls back to regular positional reads.
+ */
+class file_source : public datasource {
+  static constexpr size_t direct_io_alignment = 4096;
+  static constexpr size_t read_request_size   = 4 * 1024 * 1024;
+  static constexpr size_t read_pool_size      = 8;
+
+  class owning_buffer : public buffer {
+    std::vector<uint8_t> _data;
+
+   public:
+    explicit owning_buffer(std::vector<uint8_t> &&data) : _data(std::move(data)) {}
+    size_t size() const override { return _data.size(); }
+    const uint8_t *data() const override { return _data.data(); }
+  };
+
+  struct aligned_deleter {
+    void operator()(void *ptr) const { std::free(ptr); }
+  };
+
+  static detail::thread_pool &read_pool()
+  {
+    static detail::thread_pool pool(read_pool_size);
+    return pool;
+  }
+
+ public:
+  explicit file_source(const char *filepath, bool direct)
+  {
+    if (direct) {
+      file_      = std::make_unique<file_descriptor>(filepath, O_RDONLY | O_DIRECT);
+      is_direct_ = (file_->get() != -1);
+    }
+    if (not is_direct_) { file_ = std::make_unique<file_descriptor>(filepath, O_RDONLY); }
+    CUDF_EXPECTS(file_->get() != -1, "Cannot open file");
+    file_size_ = file_->file_size();
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    std::vector<uint8_t> data(clamped_size(offset, size));
+    data.resize(host_read(offset, data.size(), data.data()));
+    return std::make_unique<owning_buffer>(std::move(data));
   }
 
   size_t host_read(size_t offset, size_t size, uint8_t *dst) override
   {
-    CUDF_EXPECTS(offset >= map_offset_, "Requested offset is outside mapping");
+    auto const read_size = clamped_size(offset, size);
 
-    // Clamp length to available data in the mapped region
-    auto const read_size = std::min(size, map_size_ - (offset - map_offset_));
+    if (read_size <= read_request_size) {
+      read_range(offset, read_size, dst);
+      return read_size;
+    }
+
+    // Keep several requests in flight; all of them must complete before any error is rethrown
+    std::vector<std::future<void>> requests;
+    for (size_t pos = 0; pos < read_size; pos += read_request_size) {
+      auto const len = std::min(read_request_size, read_size - pos);
+      requests.emplace_back(read_pool().submit(
+        [this, offset, pos, len, dst] { read_range(offset + pos, len, dst + pos); }));
+    }
+    for (auto &request : requests) { request.wait(); }
+    for (auto &request : requests) { request.get(); }
 
-    auto const src = static_cast<uint8_t *>(map_addr_) + (offset - map_offset_);
-    std::memcpy(dst, src, read_size);
     return read_size;
   }
 
   size_t size() const override { return file_size_; }
 
  private:
-  void map(int fd, size_t offset, size_t size)
+  size_t clamped_size(size_t offset, size_t size) const
   {
-    CUDF_EXPECTS(offset < file_size_, "Offset is past end of file");
-
-    // Offset for `mmap()` must be page aligned
-    auto const map_offset = offset & ~(sysconf(_SC_PAGESIZE) - 1);
+    return (offset < file_size_) ? std::min(size, file_size_ - offset) : 0;
+  }
 
-    // Clamp length to available data in the file
-    if (size == 0) {
-      size = file_size_ - offset;
-    } else {
-      if ((offset + size) > file_size_) { size = file_size_ - offset; }
+  /**
+   * @brief Reads up to `size` bytes, retrying on short reads until the end of the file.
+   *
+   * @return The number of bytes read
+   */
+  size_t pread_all(size_t offset, size_t size, uint8_t *dst) const
+  {
+    size_t total_read = 0;
+    while (total_read < size) {
+      auto const bytes =
+        pread(file_->get(), dst + total_read, size - total_read, offset + total_read);
+      if (bytes == -1 && errno == EINTR) { continue; }
+      CUDF_EXPECTS(bytes != -1, "Cannot read file data");
+      if (bytes == 0) { break; }
+      total_read += bytes;
     }
+    return total_read;
+  }
 
-    // Size for `mmap()` needs to include the page padding
-    const auto map_size = size + (offset - map_offset);
+  /**
+   * @brief Reads a range that is within the file.
+   */
+  void read_range(size_t offset, size_t size, uint8_t *dst) const
+  {
+    if (size == 0) { return; }
+
+    auto const is_aligned = [](size_t value) { return value % direct_io_alignment == 0; };
+    if (not is_direct_ ||
+        (is_aligned(reinterpret_cast<uintptr_t>(dst)) && is_aligned(offset) && is_aligned(size))) {
+      CUDF_EXPECTS(pread_all(offset, size, dst) == size, "Unexpected end of file");
+      return;
+    }
 
-    // Check if accessing a region within already mapped area
-    map_addr_ = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, map_offset);
-    CUDF_EXPECTS(map_addr_ != MAP_FAILED, "Cannot create memory mapping");
-    map_offset_ = map_offset;
-    map_size_   = map_size;
+    // Read the enclosing aligned blocks into a bounce buffer; the last block may be partial
+    auto const aligned_offset = offset & ~(direct_io_alignment - 1);
+    auto const aligned_end =
+      (offset + size + direct_io_alignment - 1) & ~(direct_io_alignment - 1);
+    auto const aligned_size = aligned_end - aligned_offset;
+
+    void *ptr = nullptr;
+    CUDF_EXPECTS(posix_memalign(&ptr, direct_io_alignment, aligned_size) == 0,
+                 "Cannot allocate aligned read buffer");
+    std::unique_ptr<void, aligned_deleter> bounce(ptr);
+    CUDF_EXPECTS(pread_all(aligned_offset, aligned_size, static_cast<uint8_t *>(ptr)) >=
+                   offset + size - aligned_offset,
+                 "Unexpected end of file");
+    std::memcpy(dst, static_cast<uint8_t *>(ptr) + (offset - aligned_offset), size);
   }
 
  private:
-  size_t file_size_  = 0;
-  void *map_addr_    = nullptr;
-  size_t map_size_   = 0;
-  size_t map_offset_ = 0;
+  std::unique_ptr<file_descriptor> file_;
+  bool is_direct_   = false;
+  size_t file_size_ = 0;
 };
 
+constexpr size_t file_source::read_request_size;
+
 /**
  * @brief Wrapper class for user implemented data sources
  *
@@ -146,8 +419,18 @@ class user_datasource_wrapper : public datasource {
     return source->host_read(offset, size);
   }
 
+  void prefetch(std::vector<std::pair<size_t, size_t>> const &ranges) override
+  {
+    source->prefetch(ranges);
+  }
+
   bool supports_device_read() const override { return source->supports_device_read(); }
 
+  bool supports_zero_copy_host_read() const override
+  {
+    return source->supports_zero_copy_host_read();
+  }
+
   size_t device_read(size_t offset, size_t size, uint8_t *dst) override
   {
     return source->device_read(offset, size, dst);
@@ -166,10 +449,17 @@ class user_datasource_wrapper : public datasource {
 
 std::unique_ptr<datasource> datasource::create(const std::string &filepath,
                                                size_t offset,
-                                               size_t size)
+                                               size_t size,
+                                               file_read_mode mode)
 {
-  // Use our own memory mapping implementation for direct file reads
-  return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
+  switch (resolve_read_mode(mode)) {
+    case file_read_mode::POSITIONAL:
+      return std::make_unique<file_source>(filepath.c_str(), false);
+    case file_read_mode::DIRECT: return std::make_unique<file_source>(filepath.c_str(), true);
+    default:
+      // Use our own memory mapping implementation for direct file reads
+      return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
+  }
 }
 
 std::unique_ptr<datasource> datasource::create(host_buffer const &buffer)
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "host_parallel.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace {
+detail::thread_pool &host_worker_pool()
+{
+  static detail::thread_pool pool;
+  return pool;
+}
+
+// Set on the threads of the worker pool, so that nested parallel loops run inline instead
+// of waiting on tasks queued behind their own
+thread_local bool is_host_worker = false;
+
+}  // namespace
+
+void host_parallel_for(size_t count, std::function<void(size_t)> const &func)
+{
+  // Workers claim items one at a time, which balances items of uneven sizes
+  std::atomic<size_t> next_item{0};
+  auto run_items = [&]() {
+    for (auto i = next_item++; i < count; i = next_item++) { func(i); }
+  };
+
+  auto &pool = host_worker_pool();
+  std::vector<std::future<void>> helpers;
+  if (not is_host_worker) {
+    auto const num_threads = std::min<size_t>(pool.size(), count);
+    for (size_t t = 1; t < num_threads; ++t) {
+      helpers.push_back(pool.submit([&]() {
+        is_host_worker = true;
+        run_items();
+      }));
+    }
+  }
+  // The helpers reference local state; wait for all of them even if this thread fails
+  std::exception_ptr error;
+  try {
+    run_items();
+  } catch (...) {
+    error = std::current_exception();
+  }
+  for (auto &helper : helpers) {
+    try {
+      helper.get();
+    } catch (...) {
+      if (error == nullptr) { error = std::current_exception(); }
+    }
+  }
+  if (error != nullptr) { std::rethrow_exception(error); }
+}
+
+size_t host_parallel_concurrency()
+{
+  if (is_host_worker) { return 1; }
+  return std::max<size_t>(host_worker_pool().size(), 1);
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Runs `func(i)` for each `i` in `[0, count)` on a process-wide pool of host worker threads
+ *
+ * Used by the readers and the host codecs for CPU work that is split into independent items, such
+ * as decompressing blocks or parsing the metadata of several sources. The calling thread takes
+ * part in the work, and the call returns once all items are processed. The first exception thrown
+ * by `func` is rethrown. Nested calls from within `func` run on the calling thread only.
+ *
+ * @param count Number of items
+ * @param func Callable that processes one item
+ */
+void host_parallel_for(size_t count, std::function<void(size_t)> const& func);
+
+/**
+ * @brief Returns the number of threads that process the items of a `host_parallel_for()` call
+ * made from the calling thread
+ */
+size_t host_parallel_concurrency();
+
+}  // namespace io
+}  // namespace cudf
@@ -215,6 +215,7 @@ std::string infer_compression_type(
       case compression_type::BZIP2: return "bz2";
       case compression_type::ZIP: return "zip";
       case compression_type::XZ: return "xz";
+      case compression_type::ZSTD: return "zstd";
       default: break;
     }
   }
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prefetching_source.hpp"
+#include "thread_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+// IO threads spend most of their time waiting on the storage; the count bounds the number of
+// outstanding requests rather than the CPU usage
+constexpr size_t io_thread_count = 8;
+
+thread_pool &io_thread_pool()
+{
+  static thread_pool pool(io_thread_count);
+  return pool;
+}
+
+/**
+ * @brief Buffer that shares the data of a completed fetch that is returned as a whole.
+ */
+class fetched_buffer : public datasource::buffer {
+  std::shared_ptr<std::vector<uint8_t>> _fetched;
+  size_t const _size;
+
+ public:
+  fetched_buffer(std::shared_ptr<std::vector<uint8_t>> fetched, size_t size)
+    : _fetched(std::move(fetched)), _size(size)
+  {
+  }
+  size_t size() const override { return _size; }
+  const uint8_t *data() const override { return _fetched->data(); }
+};
+
+/**
+ * @brief Buffer that owns data assembled from multiple fetches.
+ */
+class owning_buffer : public datasource::buffer {
+  std::vector<uint8_t> _data;
+
+ public:
+  explicit owning_buffer(std::vector<uint8_t> &&data) : _data(std::move(data)) {}
+  owning_buffer(const uint8_t *data, size_t size) : _data(data, data + size) {}
+  size_t size() const override { return _data.size(); }
+  const uint8_t *data() const override { return _data.data(); }
+};
+
+}  // namespace
+
+prefetching_source::prefetching_source(std::unique_ptr<datasource> source,
+                                       size_t max_gap,
+                                       size_t max_fetch_size,
+                                       size_t max_inflight_bytes)
+  : source_(std::move(source)),
+    max_gap_(max_gap),
+    max_fetch_size_(max_fetch_size),
+    max_inflight_bytes_(max_inflight_bytes)
+{
+  CUDF_EXPECTS(source_ != nullptr, "Cannot prefetch from a null source");
+}
+
+prefetching_source::~prefetching_source()
+{
+  // Outstanding fetches reference the wrapped source; wait for them before it is destroyed
+  std::vector<std::shared_future<size_t>> outstanding;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto const &f : fetches_) {
+      if (f->dispatched) { outstanding.push_back(f->bytes_read); }
+    }
+    outstanding.insert(outstanding.end(), abandoned_.begin(), abandoned_.end());
+  }
+  for (auto const &fut : outstanding) { fut.wait(); }
+}
+
+void prefetching_source::prefetch(std::vector<std::pair<size_t, size_t>> const &ranges)
+{
+  auto const source_size = source_->size();
+
+  std::vector<std::pair<size_t, size_t>> sorted;
+  sorted.reserve(ranges.size());
+  for (auto const &range : ranges) {
+    if (range.second == 0 || range.first >= source_size) { continue; }
+    sorted.emplace_back(range.first, std::min(range.second, source_size - range.first));
+  }
+  std::sort(sorted.begin(), sorted.end());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  // The new hints replace the previous ones; fetches that have not been consumed are released
+  while (not fetches_.empty()) {
+    auto const f = fetches_.front();
+    if (f->dispatched) { abandoned_.push_back(f->bytes_read); }
+    retire(f);
+  }
+  abandoned_.erase(std::remove_if(abandoned_.begin(),
+                                  abandoned_.end(),
+                                  [](auto const &fut) {
+                                    return fut.wait_for(std::chrono::seconds(0)) ==
+                                           std::future_status::ready;
+                                  }),
+                   abandoned_.end());
+
+  std::shared_ptr<fetch> current;
+  for (auto const &range : sorted) {
+    auto const range_end = range.first + range.second;
+    if (current != nullptr && range.first <= current->offset + current->size + max_gap_ &&
+        range_end - current->offset <= max_fetch_size_) {
+      // Only the bytes not covered by earlier (overlapping or repeated) hints are counted
+      auto const current_end = current->offset + current->size;
+      if (range_end > current_end) {
+        current->hinted_bytes += range_end - std::max(range.first, current_end);
+        current->size = range_end - current->offset;
+      }
+    } else {
+      current               = std::make_shared<fetch>();
+      current->offset       = range.first;
+      current->size         = range.second;
+      current->hinted_bytes = range.second;
+      fetches_.push_back(current);
+    }
+  }
+  dispatch_fetches();
+}
+
+void prefetching_source::dispatch_fetches()
+{
+  for (auto const &f : fetches_) {
+    if (f->dispatched) { continue; }
+    // Always allow one fetch in flight, even if it exceeds the limit by itself
+    if (inflight_bytes_ != 0 && inflight_bytes_ + f->size > max_inflight_bytes_) { break; }
+
+    auto const source = source_.get();
+    f->bytes_read     = io_thread_pool()
+                      .submit([source, f]() -> size_t {
+                        // Released before it started, e.g. replaced by new hints
+                        if (f->released) { return 0; }
+                        f->data = std::make_shared<std::vector<uint8_t>>(f->size);
+                        return source->host_read(f->offset, f->size, f->data->data());
+                      })
+                      .share();
+    f->dispatched = true;
+    inflight_bytes_ += f->size;
+  }
+}
+
+void prefetching_source::retire(std::shared_ptr<fetch> const &f)
+{
+  auto const it = std::find(fetches_.begin(), fetches_.end(), f);
+  if (it == fetches_.end()) { return; }
+  fetches_.erase(it);
+  f->released = true;
+  if (f->dispatched) { inflight_bytes_ -= f->size; }
+}
+
+void prefetching_source::consume(std::shared_ptr<fetch> const &f, size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  f->consumed_bytes += bytes;
+  // The fetch counts against the in-flight limit for as long as it holds its data, that is until
+  // all hinted bytes have been read from it
+  if (f->consumed_bytes < f->hinted_bytes) { return; }
+  retire(f);
+  dispatch_fetches();
+}
+
+std::shared_ptr<prefetching_source::fetch> prefetching_source::find_fetch(size_t offset)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto const it = std::find_if(fetches_.begin(), fetches_.end(), [offset](auto const &f) {
+    return offset >= f->offset && offset < f->offset + f->size;
+  });
+  if (it == fetches_.end()) { return nullptr; }
+
+  auto f = *it;
+  if (not f->dispatched) {
+    // The data is needed before the fetch could be started; the caller reads it directly
+    fetches_.erase(it);
+    return nullptr;
+  }
+  return f;
+}
+
+size_t prefetching_source::wait_for(std::shared_ptr<fetch> const &f)
+{
+  try {
+    return f->bytes_read.get();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    retire(f);
+    dispatch_fetches();
+    throw;
+  }
+}
+
+std::unique_ptr<datasource::buffer> prefetching_source::host_read(size_t offset, size_t size)
+{
+  auto const f = find_fetch(offset);
+  if (f == nullptr) { return source_->host_read(offset, size); }
+
+  if (offset + size <= f->offset + f->size) {
+    auto const fetched = wait_for(f);
+    auto const data    = f->data;
+    // Released by new hints before the fetch started
+    if (data == nullptr) { return source_->host_read(offset, size); }
+    auto const skip      = offset - f->offset;
+    auto const read_size = (fetched > skip) ? std::min(size, fetched - skip) : 0;
+    consume(f, read_size);
+    // A read of the whole fetch shares its data; a part of a fetch is copied, so that the buffer
+    // does not keep the rest of the fetched data alive past the in-flight limit
+    if (skip == 0 && read_size == data->size()) {
+      return std::make_unique<fetched_buffer>(data, read_size);
+    }
+    return std::make_unique<owning_buffer>(data->data() + skip, read_size);
+  }
+
+  // The requested range spans several fetches
+  std::vector<uint8_t> data(size);
+  data.resize(host_read(offset, size, data.data()));
+  return std::make_unique<owning_buffer>(std::move(data));
+}
+
+size_t prefetching_source::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  size_t total_read = 0;
+  while (total_read < size) {
+    auto const pos = offset + total_read;
+    auto const f   = find_fetch(pos);
+    if (f == nullptr) {
+      total_read += source_->host_read(pos, size - total_read, dst + total_read);
+      break;
+    }
+
+    auto const fetched = wait_for(f);
+    if (f->data == nullptr) {
+      // Released by new hints before the fetch started
+      total_read += source_->host_read(pos, size - total_read, dst + total_read);
+      break;
+    }
+    auto const skip      = pos - f->offset;
+    auto const read_size = (fetched > skip) ? std::min(size - total_read, fetched - skip) : 0;
+    std::memcpy(dst + total_read, f->data->data() + skip, read_size);
+    consume(f, read_size);
+    total_read += read_size;
+    // Stop at the end of the source
+    if (fetched < f->size) { break; }
+  }
+  return total_read;
+}
+
+std::unique_ptr<datasource> make_prefetching_source(std::unique_ptr<datasource> &&source)
+{
+  if (source->supports_zero_copy_host_read()) { return std::move(source); }
+  return std::make_unique<prefetching_source>(std::move(source));
+}
+
+std::vector<std::unique_ptr<datasource>> make_prefetching_sources(
+  std::vector<std::unique_ptr<datasource>> &&sources)
+{
+  std::vector<std::unique_ptr<datasource>> wrapped;
+  wrapped.reserve(sources.size());
+  std::transform(std::make_move_iterator(sources.begin()),
+                 std::make_move_iterator(sources.end()),
+                 std::back_inserter(wrapped),
+                 [](auto &&source) { return make_prefetching_source(std::move(source)); });
+  return wrapped;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <atomic>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Datasource wrapper that services hinted reads ahead of time on background threads.
+ *
+ * Ranges passed to `prefetch()` are sorted and coalesced (ranges separated by at most `max_gap`
+ * bytes are merged, up to `max_fetch_size` bytes per fetch) and then read from the wrapped source
+ * on a process-wide pool of IO threads. At most `max_inflight_bytes` of fetched data is held at
+ * once; a fetch holds its data until every hinted byte it covers has been read with `host_read()`,
+ * and further fetches are dispatched as earlier ones are released. Each call to `prefetch()`
+ * replaces the hints of the previous one, releasing the fetches that were not consumed. Reads that
+ * do not fall within a hinted range are forwarded to the wrapped source.
+ *
+ * Reads of a whole fetch share its data; reads of a part of a fetch return a copy, so that the
+ * returned buffers do not hold fetched data beyond the in-flight limit.
+ *
+ * The wrapped source must support concurrent `host_read()` calls.
+ */
+class prefetching_source : public datasource {
+ public:
+  static constexpr size_t default_max_gap            = 64 * 1024;
+  static constexpr size_t default_max_fetch_size     = 64 * 1024 * 1024;
+  static constexpr size_t default_max_inflight_bytes = 256 * 1024 * 1024;
+
+  /**
+   * @brief Constructs a prefetching wrapper around a datasource.
+   *
+   * @param source The source to read from
+   * @param max_gap Largest gap between two hinted ranges that are fetched with a single read
+   * @param max_fetch_size Largest size of a coalesced read
+   * @param max_inflight_bytes Limit on the amount of fetched data that has not been consumed yet
+   */
+  explicit prefetching_source(std::unique_ptr<datasource> source,
+                              size_t max_gap            = default_max_gap,
+                              size_t max_fetch_size     = default_max_fetch_size,
+                              size_t max_inflight_bytes = default_max_inflight_bytes);
+
+  ~prefetching_source() override;
+
+  void prefetch(std::vector<std::pair<size_t, size_t>> const &ranges) override;
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  bool supports_device_read() const override { return source_->supports_device_read(); }
+
+  std::unique_ptr<buffer> device_read(size_t offset, size_t size) override
+  {
+    return source_->device_read(offset, size);
+  }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    return source_->device_read(offset, size, dst);
+  }
+
+  size_t size() const override { return source_->size(); }
+
+ private:
+  /**
+   * @brief A coalesced read, covering one or more hinted ranges.
+   */
+  struct fetch {
+    size_t offset         = 0;
+    size_t size           = 0;
+    size_t hinted_bytes   = 0;  ///< Bytes covered by the hinted ranges within the fetch
+    size_t consumed_bytes = 0;  ///< Bytes already returned from `host_read()`
+    bool dispatched       = false;
+    std::atomic<bool> released{false};  ///< No longer counted against the in-flight limit
+    std::shared_ptr<std::vector<uint8_t>> data;
+    std::shared_future<size_t> bytes_read;
+  };
+
+  /**
+   * @brief Starts pending fetches in order, as long as the in-flight limit allows.
+   *
+   * Must be called with `mutex_` held.
+   */
+  void dispatch_fetches();
+
+  /**
+   * @brief Removes a fetch and releases its in-flight budget, if not released already.
+   *
+   * Must be called with `mutex_` held.
+   */
+  void retire(std::shared_ptr<fetch> const &f);
+
+  /**
+   * @brief Accounts for consumed data, releasing the fetch once all hinted bytes are consumed.
+   */
+  void consume(std::shared_ptr<fetch> const &f, size_t bytes);
+
+  /**
+   * @brief Returns the dispatched fetch that contains the given offset, if any.
+   */
+  std::shared_ptr<fetch> find_fetch(size_t offset);
+
+  /**
+   * @brief Waits for a fetch to complete and returns the number of bytes it read.
+   */
+  size_t wait_for(std::shared_ptr<fetch> const &f);
+
+  std::unique_ptr<datasource> const source_;
+  size_t const max_gap_;
+  size_t const max_fetch_size_;
+  size_t const max_inflight_bytes_;
+
+  std::mutex mutex_;
+  std::deque<std::shared_ptr<fetch>> fetches_;  ///< In order of expected consumption
+  std::vector<std::shared_future<size_t>> abandoned_;  ///< Replaced fetches that may still run
+  size_t inflight_bytes_ = 0;
+};
+
+/**
+ * @brief Wraps a source in a `prefetching_source`, unless its `host_read()` is zero-copy.
+ *
+ * Reads from zero-copy sources, such as memory mapped files, would only gain an additional copy.
+ *
+ * @param source Source to wrap
+ *
+ * @return The wrapped source, or the source itself
+ */
+std::unique_ptr<datasource> make_prefetching_source(std::unique_ptr<datasource> &&source);
+
+/**
+ * @brief Wraps each source with `make_prefetching_source`.
+ *
+ * @param sources Sources to wrap
+ *
+ * @return The wrapped sources
+ */
+std::vector<std::unique_ptr<datasource>> make_prefetching_sources(
+  std::vector<std::unique_ptr<datasource>> &&sources);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
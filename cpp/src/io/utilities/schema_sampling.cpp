@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "schema_sampling.hpp"
+
+#include <io/comp/io_uncomp.h>
+#include <io/utilities/type_conversion.cuh>
+
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the position after the last line terminator, or `begin` if there is none.
+ */
+char const *after_last_terminator(char const *begin, char const *end, char terminator)
+{
+  return std::find(std::make_reverse_iterator(end), std::make_reverse_iterator(begin), terminator)
+    .base();
+}
+
+}  // namespace
+
+std::vector<char> sample_lines(datasource &source,
+                               std::string const &compression,
+                               char terminator,
+                               schema_sampling_options const &options)
+{
+  CUDF_EXPECTS(options.num_samples > 0 && options.sample_bytes > 0,
+               "The number and size of samples must be positive");
+  auto const total_sample_bytes = options.num_samples * options.sample_bytes;
+
+  if (compression != "none") {
+    // Compressed data can only be read sequentially; sample its beginning, reading the compressed
+    // data in growing prefixes until one decompresses to the full sample or the whole file is read
+    auto const size = source.size();
+    for (auto prefix_size = std::min(size, total_sample_bytes);;
+         prefix_size      = std::min(size, 2 * prefix_size)) {
+      auto const is_whole_file = (prefix_size == size);
+      auto const buffer        = source.host_read(0, prefix_size);
+      std::vector<char> sample(total_sample_bytes);
+      try {
+        auto const decompressor = make_stream_decompressor(
+          host_span<char const>(reinterpret_cast<char const *>(buffer->data()), buffer->size()),
+          compression);
+        sample.resize(decompressor->read(sample));
+        if (!decompressor->eof()) {
+          sample.resize(
+            after_last_terminator(sample.data(), sample.data() + sample.size(), terminator) -
+            sample.data());
+          return sample;
+        }
+      } catch (cudf::logic_error const &) {
+        // A truncated prefix cannot be decompressed up to the sample size
+        if (is_whole_file) { throw; }
+        continue;
+      }
+      // The end of a prefix may only be the end of one of several compressed members
+      if (is_whole_file) { return sample; }
+    }
+  }
+
+  auto const size = source.size();
+  if (size <= total_sample_bytes) {
+    auto const buffer = source.host_read(0, size);
+    return std::vector<char>(buffer->data(), buffer->data() + buffer->size());
+  }
+
+  std::vector<char> sample;
+  sample.reserve(total_sample_bytes + options.num_samples);
+  for (size_t i = 0; i < options.num_samples; ++i) {
+    // The samples do not overlap, as they are at least `sample_bytes` apart
+    auto const offset = (options.num_samples > 1)
+                          ? (size - options.sample_bytes) * i / (options.num_samples - 1)
+                          : 0;
+    auto const buffer = source.host_read(offset, options.sample_bytes);
+    auto const begin  = reinterpret_cast<char const *>(buffer->data());
+    auto const end    = begin + buffer->size();
+
+    // Only whole lines are sampled; a sample that ends the dataset may not be terminated
+    auto first = begin;
+    if (i != 0) {
+      auto const pos = std::find(begin, end, terminator);
+      first          = (pos != end) ? pos + 1 : end;
+    }
+    auto const last =
+      (offset + buffer->size() < size) ? after_last_terminator(begin, end, terminator) : end;
+    CUDF_EXPECTS(i != 0 || first < last, "The first row is longer than the sample size");
+    if (first < last) {
+      sample.insert(sample.end(), first, last);
+      if (sample.back() != terminator) { sample.push_back(terminator); }
+    }
+  }
+  return sample;
+}
+
+table_schema make_table_schema(table_with_metadata const &sample)
+{
+  auto const view = sample.tbl->view();
+  CUDF_EXPECTS(static_cast<size_t>(view.num_columns()) == sample.metadata.column_names.size(),
+               "Mismatched number of columns and column names");
+
+  table_schema schema;
+  schema.column_names = sample.metadata.column_names;
+  for (size_type i = 0; i < view.num_columns(); ++i) {
+    auto const &column = view.column(i);
+    auto dtype         = convert_dtype_to_string(column.type());
+    // Columns without values in the sample are inferred as the smallest type
+    if (dtype.empty() ||
+        (column.type().id() == type_id::INT8 && column.null_count() == column.size())) {
+      dtype = "str";
+    }
+    schema.dtypes.push_back(schema.column_names[i] + ":" + dtype);
+  }
+  return schema;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/types.hpp>
+
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Reads a sample of the rows of a text dataset with one row per line.
+ *
+ * Each sample is read with `datasource::host_read` and trimmed to whole lines; the first sample
+ * starts at the beginning of the dataset, so that it includes any header rows. Compressed datasets
+ * are sampled from the start of the uncompressed data, reading only as much of the compressed data
+ * as the sample requires. The whole dataset is returned if it is not larger than the total sample
+ * size.
+ *
+ * @param source Uncompressed or compressed dataset
+ * @param compression Compression type, as returned by `infer_compression_type`
+ * @param terminator Line terminator
+ * @param options Number and size of the samples
+ *
+ * @return Uncompressed sampled lines
+ */
+std::vector<char> sample_lines(datasource &source,
+                               std::string const &compression,
+                               char terminator,
+                               schema_sampling_options const &options);
+
+/**
+ * @brief Returns the schema of a table read from a sample of a dataset.
+ *
+ * Columns that only contain nulls in the sample are typed as strings, which can represent any
+ * value found in the rest of the dataset.
+ */
+table_schema make_table_schema(table_with_metadata const &sample);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "statistics_filter.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+using kind = filter_literal::kind;
+
+/**
+ * @brief Compares two literals.
+ *
+ * @param[in] lhs Left operand
+ * @param[in] rhs Right operand
+ * @param[out] result Negative, zero or positive if `lhs` is less than, equal to or greater than
+ * `rhs`, respectively
+ *
+ * @return false if the literals cannot be compared
+ */
+bool compare_literals(filter_literal const &lhs, filter_literal const &rhs, int *result)
+{
+  if (lhs.get_kind() == kind::INTEGER && rhs.get_kind() == kind::INTEGER) {
+    *result = (lhs.get_int() > rhs.get_int()) - (lhs.get_int() < rhs.get_int());
+    return true;
+  }
+  if (lhs.get_kind() == kind::STRING && rhs.get_kind() == kind::STRING) {
+    // Compares as unsigned bytes, which is the order of the string statistics
+    *result = lhs.get_string().compare(rhs.get_string());
+    return true;
+  }
+  auto const is_numeric = [](filter_literal const &l) {
+    return l.get_kind() == kind::INTEGER || l.get_kind() == kind::FLOAT;
+  };
+  if (is_numeric(lhs) && is_numeric(rhs)) {
+    auto const as_double = [](filter_literal const &l) {
+      return l.get_kind() == kind::FLOAT ? l.get_float() : static_cast<double>(l.get_int());
+    };
+    auto const l = as_double(lhs);
+    auto const r = as_double(rhs);
+    // NaN is unordered
+    if (!(l < r) && !(l > r) && !(l == r)) { return false; }
+    *result = (l > r) - (l < r);
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Evaluates a comparison; returns false only if no value within the statistics matches.
+ */
+bool may_match_comparison(filter_expression const &filter, filter_statistics const &stats)
+{
+  auto const has_null_count = stats.null_count >= 0;
+  auto const all_nulls =
+    has_null_count && stats.num_values >= 0 && stats.null_count >= stats.num_values;
+
+  switch (filter.get_op()) {
+    case filter_op::IS_NULL: return !has_null_count || stats.null_count > 0;
+    case filter_op::IS_NOT_NULL: return !all_nulls;
+    default: break;
+  }
+  // Comparisons never match nulls
+  if (all_nulls) { return false; }
+
+  auto const &value = filter.get_literal();
+  int min_cmp       = 0;
+  int max_cmp       = 0;
+  auto const has_min =
+    stats.min.get_kind() != kind::NONE && compare_literals(stats.min, value, &min_cmp);
+  auto const has_max =
+    stats.max.get_kind() != kind::NONE && compare_literals(stats.max, value, &max_cmp);
+
+  switch (filter.get_op()) {
+    case filter_op::EQUAL: return !((has_min && min_cmp > 0) || (has_max && max_cmp < 0));
+    case filter_op::NOT_EQUAL: return !(has_min && has_max && min_cmp == 0 && max_cmp == 0);
+    case filter_op::LESS: return !(has_min && min_cmp >= 0);
+    case filter_op::LESS_EQUAL: return !(has_min && min_cmp > 0);
+    case filter_op::GREATER: return !(has_max && max_cmp <= 0);
+    case filter_op::GREATER_EQUAL: return !(has_max && max_cmp < 0);
+    default: CUDF_FAIL("Unsupported filter operator");
+  }
+}
+
+}  // namespace
+
+bool may_match(filter_expression const &filter, filter_statistics_lookup const &lookup)
+{
+  auto const &children = filter.get_children();
+  switch (filter.get_type()) {
+    case filter_expression::node_type::COMPARE:
+      return may_match_comparison(filter, lookup(filter.get_column_name()));
+    case filter_expression::node_type::ALL_OF:
+      return std::all_of(children.cbegin(), children.cend(), [&](auto const &child) {
+        return may_match(child, lookup);
+      });
+    case filter_expression::node_type::ANY_OF:
+      return std::any_of(children.cbegin(), children.cend(), [&](auto const &child) {
+        return may_match(child, lookup);
+      });
+    default: CUDF_FAIL("Unsupported filter expression");
+  }
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
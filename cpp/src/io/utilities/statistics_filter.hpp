@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/filter.hpp>
+
+#include <functional>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Statistics of a column within a part of a file, such as a row group or a stripe.
+ */
+struct filter_statistics {
+  filter_literal min;        ///< Minimum value; NONE if unknown
+  filter_literal max;        ///< Maximum value; NONE if unknown
+  int64_t null_count = -1;   ///< Number of nulls; negative if unknown
+  int64_t num_values = -1;   ///< Number of values, including nulls; negative if unknown
+};
+
+/**
+ * @brief Callback that returns the statistics of the named column in the evaluated file part.
+ */
+using filter_statistics_lookup = std::function<filter_statistics(std::string const &)>;
+
+/**
+ * @brief Evaluates a filter against the statistics of a part of a file.
+ *
+ * @param filter The filter expression
+ * @param lookup Callback returning the statistics of each column referenced by the filter
+ *
+ * @return false if the statistics show that no row of the part can match the filter
+ */
+bool may_match(filter_expression const &filter, filter_statistics_lookup const &lookup);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief A fixed-size pool of worker threads that execute submitted tasks in FIFO order.
+ *
+ * Used by the IO layer for host-side work that can overlap with device work, such as reading
+ * ahead from a datasource or decompressing blocks on the CPU.
+ */
+class thread_pool {
+ public:
+  /**
+   * @brief Constructs a pool with the given number of worker threads.
+   *
+   * @param num_threads Number of workers; zero selects the hardware concurrency
+   */
+  explicit thread_pool(size_t num_threads = 0)
+  {
+    if (num_threads == 0) {
+      num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    workers_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+      workers_.emplace_back([this] { worker_loop(); });
+    }
+  }
+
+  thread_pool(thread_pool const &) = delete;
+  thread_pool &operator=(thread_pool const &) = delete;
+
+  ~thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) { worker.join(); }
+  }
+
+  /**
+   * @brief Returns the number of worker threads.
+   */
+  size_t size() const { return workers_.size(); }
+
+  /**
+   * @brief Queues a callable for execution on one of the workers.
+   *
+   * Exceptions thrown by the callable are propagated through the returned future.
+   *
+   * @param func Callable with no arguments
+   *
+   * @return Future holding the result of the callable
+   */
+  template <typename F>
+  auto submit(F &&func) -> std::future<std::result_of_t<std::decay_t<F>()>>
+  {
+    using result_type = std::result_of_t<std::decay_t<F>()>;
+    auto task = std::make_shared<std::packaged_task<result_type()>>(std::forward<F>(func));
+    auto result = task->get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.emplace([task] { (*task)(); });
+    }
+    cv_.notify_one();
+    return result;
+  }
+
+ private:
+  void worker_loop()
+  {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+        if (tasks_.empty()) { return; }
+        task = std::move(tasks_.front());
+        tasks_.pop();
+      }
+      task();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stopping_ = false;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
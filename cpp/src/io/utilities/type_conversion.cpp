@@ -66,5 +66,37 @@ data_type convert_string_to_dtype(const std::string& dtype_in)
   return data_type(cudf::type_id::EMPTY);
 }
 
+/**
+ * @copydoc cudf::io:convert_dtype_to_string
+ */
+std::string convert_dtype_to_string(data_type dtype)
+{
+  switch (dtype.id()) {
+    case cudf::type_id::STRING: return "str";
+    case cudf::type_id::TIMESTAMP_DAYS: return "date32";
+    case cudf::type_id::TIMESTAMP_SECONDS: return "timestamp[s]";
+    case cudf::type_id::TIMESTAMP_MILLISECONDS: return "timestamp[ms]";
+    case cudf::type_id::TIMESTAMP_MICROSECONDS: return "timestamp[us]";
+    case cudf::type_id::TIMESTAMP_NANOSECONDS: return "timestamp[ns]";
+    case cudf::type_id::BOOL8: return "bool";
+    case cudf::type_id::DURATION_DAYS: return "timedelta[d]";
+    case cudf::type_id::DURATION_SECONDS: return "timedelta64[s]";
+    case cudf::type_id::DURATION_MILLISECONDS: return "timedelta64[ms]";
+    case cudf::type_id::DURATION_MICROSECONDS: return "timedelta64[us]";
+    case cudf::type_id::DURATION_NANOSECONDS: return "timedelta64[ns]";
+    case cudf::type_id::FLOAT32: return "float32";
+    case cudf::type_id::FLOAT64: return "float64";
+    case cudf::type_id::INT8: return "int8";
+    case cudf::type_id::INT16: return "int16";
+    case cudf::type_id::INT32: return "int32";
+    case cudf::type_id::INT64: return "int64";
+    case cudf::type_id::UINT8: return "uint8";
+    case cudf::type_id::UINT16: return "uint16";
+    case cudf::type_id::UINT32: return "uint32";
+    case cudf::type_id::UINT64: return "uint64";
+    default: return "";
+  }
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -27,5 +27,14 @@ namespace io {
  */
 data_type convert_string_to_dtype(const std::string &dtype);
 
+/**
+ * @brief Convert a cuDF data_type to the string accepted by `convert_string_to_dtype`
+ *
+ * @param[in] dtype The data type to be converted
+ *
+ * @return std::string The converted string; empty if the type has no string representation
+ */
+std::string convert_dtype_to_string(data_type dtype);
+
 }  // namespace io
 }  // namespace cudf
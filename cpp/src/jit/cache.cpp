@@ -22,8 +22,14 @@
 #include <pwd.h>
 #include <stdio.h>
 #include <unistd.h>
+#include <utime.h>
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
+#include <ctime>
+#include <sstream>
+#include <thread>
+
 #include <cuda.h>
 
 namespace cudf {
@@ -85,13 +91,52 @@ boost::filesystem::path getCacheDir()
   return kernel_cache_path;
 }
 
+/**
+ * @brief Get the maximum total size in bytes of the files in the JITIFY kernel cache directory.
+ *
+ * The limit can be set at runtime with an environment variable named
+ * `LIBCUDF_KERNEL_CACHE_LIMIT`; 0 disables the limit. The default limit is 1 GiB.
+ */
+std::uintmax_t getCacheLimit()
+{
+  auto kernel_cache_limit_env = std::getenv("LIBCUDF_KERNEL_CACHE_LIMIT");
+  if (kernel_cache_limit_env != nullptr) {
+    try {
+      return std::stoull(kernel_cache_limit_env);
+    } catch (const std::exception& e) {
+      // Ignore invalid values
+    }
+  }
+  return std::uintmax_t{1} << 30;
+}
+
+/**
+ * @brief Returns a hash of the contents of a cached object, as a 16 character hex string.
+ */
+std::string getContentHash(std::vector<std::string> const& contents)
+{
+  // 64-bit FNV-1a, over the contents and their sizes so that the boundaries are hashed too
+  uint64_t hash         = 0xcbf29ce484222325ull;
+  auto const hash_bytes = [&](char const* data, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      hash ^= static_cast<uint8_t>(data[i]);
+      hash *= 0x100000001b3ull;
+    }
+  };
+  for (auto const& content : contents) {
+    uint64_t const size = content.size();
+    hash_bytes(reinterpret_cast<char const*>(&size), sizeof(size));
+    hash_bytes(content.data(), content.size());
+  }
+  char hex[17];
+  snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+  return std::string(hex);
+}
+
 cudfJitCache::cudfJitCache() {}
 
 cudfJitCache::~cudfJitCache() {}
 
-std::mutex cudfJitCache::_kernel_cache_mutex;
-std::mutex cudfJitCache::_program_cache_mutex;
-
 named_prog<jitify::experimental::Program> cudfJitCache::getProgram(
   std::string const& prog_name,
   std::string const& cuda_source,
@@ -99,13 +144,28 @@ named_prog<jitify::experimental::Program> cudfJitCache::getProgram(
   std::vector<std::string> const& given_options,
   jitify::experimental::file_callback_type file_callback)
 {
-  // Lock for thread safety
-  std::lock_guard<std::mutex> lock(_program_cache_mutex);
+  if (cuda_source.empty()) {
+    auto const named_program = named_program_map.find(prog_name);
+    CUDF_EXPECTS(named_program != nullptr, "Program not found in cache, Needs source string.");
+    return *named_program;
+  }
 
-  return getCached(prog_name, program_map, [&]() {
-    CUDF_EXPECTS(not cuda_source.empty(), "Program not found in cache, Needs source string.");
-    return jitify::experimental::Program(cuda_source, given_headers, given_options, file_callback);
+  // Key of the program in the memory and file caches, e.g. "prog_binop.0123456789abcdef"
+  std::vector<std::string> contents{prog_name, cuda_source};
+  contents.insert(contents.end(), given_headers.begin(), given_headers.end());
+  contents.insert(contents.end(), given_options.begin(), given_options.end());
+  auto const prog_key = prog_name + '.' + getContentHash(contents);
+
+  auto program = program_map.get_or_init(prog_key, [&]() {
+    auto program = getFileCached<jitify::experimental::Program>(prog_key, [&]() {
+      return jitify::experimental::Program(
+        cuda_source, given_headers, given_options, file_callback);
+    });
+    named_program_map.assign(
+      prog_name, std::make_shared<named_prog<jitify::experimental::Program>>(prog_key, program));
+    return program;
   });
+  return std::make_pair(prog_key, program);
 }
 
 named_prog<jitify::experimental::KernelInstantiation> cudfJitCache::getKernelInstantiation(
@@ -113,24 +173,24 @@ named_prog<jitify::experimental::KernelInstantiation> cudfJitCache::getKernelIns
   named_prog<jitify::experimental::Program> const& named_program,
   std::vector<std::string> const& arguments)
 {
-  // Lock for thread safety
-  std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
-
-  std::string prog_name                  = std::get<0>(named_program);
+  // The name of the program is its cache key, which includes the hash of its contents
+  std::string prog_key                   = std::get<0>(named_program);
   jitify::experimental::Program& program = *std::get<1>(named_program);
 
-  // Make instance name e.g. "prog_binop.kernel_v_v_int_int_long int_Add"
-  std::string kern_inst_name = prog_name + '.' + kern_name;
+  // Make instance name e.g. "prog_binop.0123456789abcdef.kernel_v_v_int_int_long int_Add"
+  std::string kern_inst_name = prog_key + '.' + kern_name;
   for (auto&& arg : arguments) kern_inst_name += '_' + arg;
 
+  // Kernels are compiled for the current context
   CUcontext c;
   cuCtxGetCurrent(&c);
+  auto const context_key = std::to_string(reinterpret_cast<uintptr_t>(c)) + ':';
 
-  auto& kernel_inst_map = kernel_inst_context_map[c];
-
-  return getCached(kern_inst_name, kernel_inst_map, [&]() {
-    return program.kernel(kern_name).instantiate(arguments);
+  auto kernel = kernel_inst_map.get_or_init(context_key + kern_inst_name, [&]() {
+    return getFileCached<jitify::experimental::KernelInstantiation>(
+      kern_inst_name, [&]() { return program.kernel(kern_name).instantiate(arguments); });
   });
+  return std::make_pair(kern_inst_name, kernel);
 }
 
 // Another overload for getKernelInstantiation which might be useful to get
@@ -154,33 +214,90 @@ jitify::experimental::KernelInstantiation cudfJitCache::getKernelInstantiation(
 }
 */
 
+void cudfJitCache::evictFileCache(boost::filesystem::path const& cache_dir,
+                                  boost::filesystem::path const& keep,
+                                  std::uintmax_t keep_size)
+{
+  auto const limit = getCacheLimit();
+  if (limit == 0) { return; }
+
+  // A single thread of the process scans the directory at a time
+  static std::mutex eviction_mutex;
+  std::lock_guard<std::mutex> lock(eviction_mutex);
+
+  // Estimated total size of the directory: its size at the last scan, plus the size of the files
+  // this process wrote since. Files written by other processes are only accounted for by scans.
+  static boost::filesystem::path tracked_dir;
+  static std::uintmax_t tracked_size = 0;
+  if (tracked_dir == cache_dir) {
+    tracked_size += keep_size;
+    if (tracked_size <= limit) { return; }
+  }
+
+  // Temporary files that are this old were left behind by processes that failed to rename them
+  constexpr std::time_t stale_tmp_file_age = 60 * 60;
+  auto const now                           = std::time(nullptr);
+
+  struct cached_file {
+    std::time_t last_used;
+    std::uintmax_t size;
+    boost::filesystem::path path;
+  };
+  std::vector<cached_file> files;
+  std::uintmax_t total_size = 0;
+  boost::system::error_code dir_ec;
+  for (boost::filesystem::directory_iterator it(cache_dir, dir_ec), end; !dir_ec && it != end;
+       it.increment(dir_ec)) {
+    auto const& path = it->path();
+    if (path == keep) { continue; }
+    // Files that cannot be queried, e.g. because another process just removed them, are skipped
+    boost::system::error_code ec;
+    if (!boost::filesystem::is_regular_file(path, ec)) { continue; }
+    auto const size = boost::filesystem::file_size(path, ec);
+    if (ec) { continue; }
+    auto const last_used = boost::filesystem::last_write_time(path, ec);
+    if (ec) { continue; }
+    // Skip the files still being written
+    if (path.filename().string().find(".tmp.") != std::string::npos) {
+      if (now - last_used > stale_tmp_file_age) { boost::filesystem::remove(path, ec); }
+      continue;
+    }
+    files.push_back({last_used, size, path});
+    total_size += size;
+  }
+  // The kept file may have been evicted by another process in the meantime
+  boost::system::error_code keep_ec;
+  auto const kept_size = boost::filesystem::file_size(keep, keep_ec);
+  if (not keep_ec) { total_size += kept_size; }
+
+  if (total_size > limit) {
+    std::sort(files.begin(), files.end(), [](auto const& lhs, auto const& rhs) {
+      return lhs.last_used < rhs.last_used;
+    });
+    for (auto const& file : files) {
+      if (total_size <= limit) { break; }
+      // Files removed concurrently by other processes are ignored
+      boost::system::error_code ec;
+      if (boost::filesystem::remove(file.path, ec)) { total_size -= file.size; }
+    }
+  }
+  tracked_dir  = cache_dir;
+  tracked_size = total_size;
+}
+
 cudfJitCache::cacheFile::cacheFile(std::string file_name) : _file_name{file_name} {}
 
 cudfJitCache::cacheFile::~cacheFile() {}
 
 std::string cudfJitCache::cacheFile::read()
 {
-  // Open file (duh)
-  int fd = open(_file_name.c_str(), O_RDWR);
-  if (fd == -1) {
+  // Files are replaced atomically by writers, so no lock is needed
+  FILE* fp = fopen(_file_name.c_str(), "rb");
+  if (fp == nullptr) {
     successful_read = false;
     return std::string();
   }
 
-  // Create args for file locking
-  flock fl{};
-  fl.l_type   = F_RDLCK;  // Shared lock for reading
-  fl.l_whence = SEEK_SET;
-
-  // Lock the file descriptor. Only reading is allowed now
-  if (fcntl(fd, F_SETLKW, &fl) == -1) {
-    successful_read = false;
-    return std::string();
-  }
-
-  // Get file descriptor from file pointer
-  FILE* fp = fdopen(fd, "rb");
-
   // Get file length
   fseek(fp, 0L, SEEK_END);
   size_t file_size = ftell(fp);
@@ -192,48 +309,56 @@ std::string cudfJitCache::cacheFile::read()
   char* buffer = &content[0];
 
   // Copy file into buffer
-  if (fread(buffer, file_size, 1, fp) != 1) {
+  if (file_size == 0 || fread(buffer, file_size, 1, fp) != 1) {
     successful_read = false;
     fclose(fp);
-    free(buffer);
     return std::string();
   }
   fclose(fp);
   successful_read = true;
 
+  // Mark the file as recently used
+  utime(_file_name.c_str(), nullptr);
+
   return content;
 }
 
 void cudfJitCache::cacheFile::write(std::string content)
 {
-  // Open file and create if it doesn't exist, with access 0600
-  int fd = open(_file_name.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+  // Write a temporary file unique to this thread, with access 0600
+  std::ostringstream tmp_name;
+  tmp_name << _file_name << ".tmp." << getpid() << '.' << std::this_thread::get_id();
+  auto const tmp_file_name = tmp_name.str();
+  int fd = open(tmp_file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
   if (fd == -1) {
     successful_write = false;
     return;
   }
 
-  // Create args for file locking
-  flock fl{};
-  fl.l_type   = F_WRLCK;  // Exclusive lock for writing
-  fl.l_whence = SEEK_SET;
-
-  // Lock the file descriptor. we the only ones now
-  if (fcntl(fd, F_SETLKW, &fl) == -1) {
+  // Get file pointer from file descriptor
+  FILE* fp = fdopen(fd, "wb");
+  if (fp == nullptr) {
     successful_write = false;
+    close(fd);
+    unlink(tmp_file_name.c_str());
     return;
   }
 
-  // Get file descriptor from file pointer
-  FILE* fp = fdopen(fd, "wb");
+  // Copy string into file. Buffered write errors (e.g. a full disk) are only reported on close,
+  // and an incomplete file must never be renamed into place
+  bool const written = fwrite(content.c_str(), content.length(), 1, fp) == 1;
+  if (fclose(fp) != 0 || not written) {
+    successful_write = false;
+    unlink(tmp_file_name.c_str());
+    return;
+  }
 
-  // Copy string into file
-  if (fwrite(content.c_str(), content.length(), 1, fp) != 1) {
+  // Replace the file atomically
+  if (rename(tmp_file_name.c_str(), _file_name.c_str()) != 0) {
     successful_write = false;
-    fclose(fp);
+    unlink(tmp_file_name.c_str());
     return;
   }
-  fclose(fp);
 
   successful_write = true;
   return;
@@ -20,10 +20,14 @@
 #include <boost/filesystem.hpp>
 #include <cudf/utilities/error.hpp>
 #include <jitify.hpp>
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace cudf {
 namespace jit {
@@ -46,6 +50,22 @@ using named_prog = std::pair<std::string, std::shared_ptr<Tv>>;
  */
 boost::filesystem::path getCacheDir();
 
+/**
+ * @brief Get the maximum total size in bytes of the files in the JITIFY kernel cache directory.
+ *
+ * The limit can be set at runtime with an environment variable named
+ * `LIBCUDF_KERNEL_CACHE_LIMIT`; 0 disables the limit. The default limit is 1 GiB.
+ */
+std::uintmax_t getCacheLimit();
+
+/**
+ * @brief Returns a hash of the contents of a cached object, as a 16 character hex string.
+ *
+ * Cache entries, in memory and in files, are named by the hash of everything they are compiled
+ * from, so that an entry is never reused for a different source, header or compiler option.
+ */
+std::string getContentHash(std::vector<std::string> const& contents);
+
 class cudfJitCache {
  public:
   /**
@@ -85,13 +105,17 @@ class cudfJitCache {
    * Searches an internal in-memory cache and file based cache for the Jitify
    * pre-processed program and if not found, JIT processes and returns it
    *
+   * Programs are cached by their name and the hash of their source, headers and options, so
+   * programs of the same name that are compiled differently are cached separately. If
+   * `cuda_source` is empty, the program last created under the name is returned.
+   *
    * @param prog_file_name name of program to return
    * @param cuda_source    string source code of program to compile
    * @param given_headers  vector of strings representing source or names of each header included in
    *                       cuda_source
    * @param given_options  vector of strings options to pass to NVRTC
    * @param file_callback  pointer to callback function to call whenever a header needs to be loaded
-   * @return named_prog<jitify::experimental::Program>
+   * @return named_prog<jitify::experimental::Program>, named by the cache key of the program
    */
   named_prog<jitify::experimental::Program> getProgram(
     std::string const& prog_file_name,
@@ -101,28 +125,97 @@ class cudfJitCache {
     jitify::experimental::file_callback_type file_callback = nullptr);
 
  private:
+  /**
+   * @brief Map from names to cached objects, safe for concurrent use
+   *
+   * The map is split in shards guarded by reader-writer locks, so that lookups of cached objects
+   * proceed concurrently. Each entry is initialized once, under a lock of its own: concurrent
+   * requests for the same object wait for a single compilation, while other objects are compiled
+   * concurrently.
+   */
   template <typename Tv>
-  using umap_str_shptr = std::unordered_map<std::string, std::shared_ptr<Tv>>;
-
-  std::unordered_map<CUcontext, umap_str_shptr<jitify::experimental::KernelInstantiation>>
-    kernel_inst_context_map;
-  umap_str_shptr<jitify::experimental::Program> program_map;
-
-  /*
-    Even though this class can be used as a non-singleton, the file cache
-    access should remain limited to one thread per process. The lockf locks can
-    prevent multiple processes from accessing the file but are ineffective in
-    preventing multiple threads from doing so as the lock is shared by the
-    entire process.
-    Therefore the mutexes are static.
-    */
-  static std::mutex _kernel_cache_mutex;
-  static std::mutex _program_cache_mutex;
+  class concurrent_map {
+   public:
+    /**
+     * @brief Returns the object cached under `name`, calling `init` to create it if needed
+     *
+     * If `init` throws, the exception is propagated and the next request calls `init` again.
+     */
+    template <typename InitFunc>
+    std::shared_ptr<Tv> get_or_init(std::string const& name, InitFunc init)
+    {
+      auto& shard = shards[std::hash<std::string>{}(name) % num_shards];
+      std::shared_ptr<entry> found;
+      {
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        auto const it = shard.entries.find(name);
+        if (it != shard.entries.end()) { found = it->second; }
+      }
+      if (found == nullptr) {
+        std::unique_lock<std::shared_timed_mutex> lock(shard.mutex);
+        auto& slot = shard.entries[name];
+        if (slot == nullptr) { slot = std::make_shared<entry>(); }
+        found = slot;
+      }
+      if (auto value = std::atomic_load(&found->value)) { return value; }
+
+      std::lock_guard<std::mutex> lock(found->mutex);
+      auto value = std::atomic_load(&found->value);
+      if (value == nullptr) {
+        value = init();
+        std::atomic_store(&found->value, value);
+      }
+      return value;
+    }
+
+    /**
+     * @brief Returns the object cached under `name`, or nullptr if there is none
+     */
+    std::shared_ptr<Tv> find(std::string const& name)
+    {
+      auto& shard = shards[std::hash<std::string>{}(name) % num_shards];
+      std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+      auto const it = shard.entries.find(name);
+      return (it != shard.entries.end()) ? std::atomic_load(&it->second->value) : nullptr;
+    }
+
+    /**
+     * @brief Caches `value` under `name`, replacing the object cached under `name` if any
+     */
+    void assign(std::string const& name, std::shared_ptr<Tv> value)
+    {
+      auto& shard = shards[std::hash<std::string>{}(name) % num_shards];
+      std::unique_lock<std::shared_timed_mutex> lock(shard.mutex);
+      auto& slot = shard.entries[name];
+      if (slot == nullptr) { slot = std::make_shared<entry>(); }
+      std::atomic_store(&slot->value, std::move(value));
+    }
+
+   private:
+    struct entry {
+      std::mutex mutex;  // Held while the object is created
+      std::shared_ptr<Tv> value;
+    };
+    struct shard {
+      std::shared_timed_mutex mutex;
+      std::unordered_map<std::string, std::shared_ptr<entry>> entries;
+    };
+    static constexpr std::size_t num_shards = 16;
+    std::array<shard, num_shards> shards;
+  };
+
+  // Programs and kernels are cached under keys that include the hash of their contents
+  concurrent_map<jitify::experimental::KernelInstantiation> kernel_inst_map;
+  concurrent_map<jitify::experimental::Program> program_map;
+  // Last program created under each name, for the lookups of programs by name only
+  concurrent_map<named_prog<jitify::experimental::Program>> named_program_map;
 
  private:
   /**
-   * @brief Class to allow process wise exclusive access to cache files
+   * @brief Class to access a file of the file cache
    *
+   * Files are written to a temporary file that is then renamed, so that concurrent readers, in
+   * this or other processes, see either no file or a complete file without locking.
    */
   class cacheFile {
    private:
@@ -137,6 +230,7 @@ class cudfJitCache {
     /**
      * @brief Read this file and return the contents as a std::string
      *
+     * A successful read marks the file as recently used, for the eviction of the file cache.
      */
     std::string read();
 
@@ -158,47 +252,57 @@ class cudfJitCache {
      * @brief Check whether the write() operation on the file completed successfully
      *
      * @return true Write was successful.
-     * @return false Write was unsuccessful. File state is undefined
+     * @return false Write was unsuccessful. The file is unchanged
      */
     bool is_write_successful() { return successful_write; }
   };
 
+  /**
+   * @brief Removes the least recently used files of the cache directory until their total size is
+   * within `getCacheLimit()`, sparing the file `keep` of `keep_size` bytes that was just written
+   *
+   * The size of the directory is tracked within the process, and the directory is only scanned
+   * once the tracked size exceeds the limit. Scans also remove stale temporary files.
+   */
+  static void evictFileCache(boost::filesystem::path const& cache_dir,
+                             boost::filesystem::path const& keep,
+                             std::uintmax_t keep_size);
+
  private:
+  /**
+   * @brief Reads a serialized object from the file cache, or creates it with `func` and writes it
+   * to the file cache
+   *
+   * @param file_name Name of the cache file, unique to the contents of the object
+   * @param func Function creating the object if it is not in the file cache
+   */
   template <typename T, typename FallbackFunc>
-  named_prog<T> getCached(std::string const& name, umap_str_shptr<T>& map, FallbackFunc func)
+  std::shared_ptr<T> getFileCached(std::string const& file_name, FallbackFunc func)
   {
-    // Find memory cached T object
-    auto it = map.find(name);
-    if (it != map.end()) {
-      return std::make_pair(name, it->second);
-    } else {  // Find file cached T object
-      bool successful_read = false;
-      std::string serialized;
+    bool successful_read = false;
+    std::string serialized;
 #if defined(JITIFY_USE_CACHE)
-      boost::filesystem::path cache_dir = getCacheDir();
-      if (not cache_dir.empty()) {
-        boost::filesystem::path file_name = cache_dir / name;
-        cacheFile file{file_name.string()};
-        serialized      = file.read();
-        successful_read = file.is_read_successful();
-      }
+    boost::filesystem::path cache_dir = getCacheDir();
+    if (not cache_dir.empty()) {
+      cacheFile file{(cache_dir / file_name).string()};
+      serialized      = file.read();
+      successful_read = file.is_read_successful();
+    }
 #endif
-      if (not successful_read) {
-        // JIT compile and write to file if possible
-        serialized = func().serialize();
+    if (not successful_read) {
+      // JIT compile and write to file if possible
+      serialized = func().serialize();
 #if defined(JITIFY_USE_CACHE)
-        if (not cache_dir.empty()) {
-          boost::filesystem::path file_name = cache_dir / name;
-          cacheFile file{file_name.string()};
-          file.write(serialized);
+      if (not cache_dir.empty()) {
+        cacheFile file{(cache_dir / file_name).string()};
+        file.write(serialized);
+        if (file.is_write_successful()) {
+          evictFileCache(cache_dir, cache_dir / file_name, serialized.size());
         }
-#endif
       }
-      // Add deserialized T to cache and return
-      auto program = std::make_shared<T>(T::deserialize(serialized));
-      map[name]    = program;
-      return std::make_pair(name, program);
+#endif
     }
+    return std::make_shared<T>(T::deserialize(serialized));
   }
 };
 
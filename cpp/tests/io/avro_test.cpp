@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/io/avro.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <numeric>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+/**
+ * @brief Returns the string value of a row of the test files
+ */
+std::string row_string(size_t row, size_t min_size)
+{
+  auto str = "row_" + std::to_string(row);
+  str.resize(std::max(min_size, str.size()), 'x');
+  return str;
+}
+
+/**
+ * @brief Writes an uncompressed Avro file with a `long` column "a" and a `string` column "b"
+ *
+ * Row `i` holds `i` and `row_string(i, string_size)`.
+ *
+ * @param filepath Path of the file to write
+ * @param block_rows Number of rows of each block
+ * @param string_size Minimum size of the strings
+ *
+ * @return Offsets of the sync markers that follow the blocks
+ */
+std::vector<size_t> write_avro_file(std::string const& filepath,
+                                    std::vector<size_t> const& block_rows,
+                                    size_t string_size = 0)
+{
+  std::vector<uint8_t> data;
+  auto append_long = [](std::vector<uint8_t>& out, int64_t val) {
+    auto zigzag = (static_cast<uint64_t>(val) << 1) ^ static_cast<uint64_t>(val >> 63);
+    for (; zigzag >= 0x80; zigzag >>= 7) { out.push_back(static_cast<uint8_t>(zigzag | 0x80)); }
+    out.push_back(static_cast<uint8_t>(zigzag));
+  };
+  auto append_string = [&](std::vector<uint8_t>& out, std::string const& str) {
+    append_long(out, str.size());
+    out.insert(out.end(), str.begin(), str.end());
+  };
+  std::vector<uint8_t> sync_marker(16);
+  for (size_t i = 0; i < sync_marker.size(); ++i) { sync_marker[i] = 0xa5 ^ (i * 7); }
+
+  data = {'O', 'b', 'j', 1};
+  append_long(data, 2);
+  append_string(data, "avro.schema");
+  append_string(data,
+                R"({"type":"record","name":"test","fields":[)"
+                R"({"name":"a","type":"long"},{"name":"b","type":"string"}]})");
+  append_string(data, "avro.codec");
+  append_string(data, "null");
+  append_long(data, 0);
+  data.insert(data.end(), sync_marker.begin(), sync_marker.end());
+
+  std::vector<size_t> marker_offsets;
+  size_t row = 0;
+  for (auto const num_rows : block_rows) {
+    std::vector<uint8_t> block;
+    for (size_t i = 0; i < num_rows; ++i, ++row) {
+      append_long(block, row);
+      append_string(block, row_string(row, string_size));
+    }
+    append_long(data, num_rows);
+    append_long(data, block.size());
+    data.insert(data.end(), block.begin(), block.end());
+    marker_offsets.push_back(data.size());
+    data.insert(data.end(), sync_marker.begin(), sync_marker.end());
+  }
+
+  std::ofstream out(filepath, std::ios::binary);
+  out.write(reinterpret_cast<char const*>(data.data()), data.size());
+  return marker_offsets;
+}
+
+/**
+ * @brief Returns the expected contents of a file written with `write_avro_file()`
+ */
+std::unique_ptr<cudf::table> expected_table(size_t num_rows, size_t string_size = 0)
+{
+  std::vector<int64_t> a(num_rows);
+  std::vector<std::string> b(num_rows);
+  for (size_t i = 0; i < num_rows; ++i) {
+    a[i] = i;
+    b[i] = row_string(i, string_size);
+  }
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(cudf::test::fixed_width_column_wrapper<int64_t>(a.begin(), a.end()).release());
+  columns.push_back(cudf::test::strings_column_wrapper(b.begin(), b.end()).release());
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+/**
+ * @brief Reads a file with the chunked API and concatenates the chunks
+ */
+std::unique_ptr<cudf::table> read_chunked(cudf_io::avro_reader_options const& opts,
+                                          cudf::size_type chunk_rows)
+{
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  auto state = cudf_io::read_avro_chunked_begin(opts, chunk_rows);
+  while (cudf_io::read_avro_chunked_has_next(state)) {
+    chunks.push_back(cudf_io::read_avro_chunked(state).tbl);
+    EXPECT_GT(chunks.back()->num_rows(), 0);
+    EXPECT_LE(chunks.back()->num_rows(), chunk_rows);
+  }
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+  return cudf::concatenate(views);
+}
+
+struct AvroReaderTest : public cudf::test::BaseFixture {
+};
+
+// Blocks of uneven sizes, including a single row block
+std::vector<size_t> const test_block_rows{1000, 1, 2500, 700, 1300, 500};
+cudf::size_type const test_num_rows = 6001;
+
+TEST_F(AvroReaderTest, ChunkedRead)
+{
+  auto filepath = temp_env->get_temp_filepath("AvroChunkedRead.avro");
+  write_avro_file(filepath, test_block_rows);
+  auto const expected = expected_table(test_num_rows);
+
+  cudf_io::avro_reader_options opts =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath});
+  auto const result = cudf_io::read_avro(opts);
+  cudf::test::expect_tables_equal(expected->view(), result.tbl->view());
+  ASSERT_EQ(result.metadata.column_names.size(), 2);
+  EXPECT_EQ(result.metadata.column_names[0], "a");
+  EXPECT_EQ(result.metadata.column_names[1], "b");
+
+  // Chunks smaller than, equal to and larger than the blocks
+  for (cudf::size_type chunk_rows : {700, 900, 2500, test_num_rows + 1}) {
+    auto const chunked = read_chunked(opts, chunk_rows);
+    cudf::test::expect_tables_equal(expected->view(), chunked->view());
+  }
+
+  // Single row chunks around the end of a block
+  cudf_io::avro_reader_options range_opts =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath})
+      .skip_rows(995)
+      .num_rows(10);
+  auto const chunked = read_chunked(range_opts, 1);
+  cudf::test::expect_tables_equal(cudf::slice(expected->view(), {995, 1005})[0], chunked->view());
+}
+
+TEST_F(AvroReaderTest, SkipRowsAcrossBlocks)
+{
+  auto filepath = temp_env->get_temp_filepath("AvroSkipRowsAcrossBlocks.avro");
+  write_avro_file(filepath, test_block_rows);
+  auto const expected = expected_table(test_num_rows);
+
+  // Ranges that start and end at, before and after the block boundaries
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const ranges{
+    {0, 1000}, {999, 2}, {1000, 1}, {1000, 2}, {500, 3000}, {3500, 2400}, {4200, 1500},
+    {5990, 100}, {6000, -1}, {1234, -1}};
+  for (auto const& range : ranges) {
+    auto const skip_rows = range.first;
+    auto const end_row   = (range.second < 0) ? test_num_rows
+                                              : std::min(test_num_rows, skip_rows + range.second);
+    auto const expected_rows = cudf::slice(expected->view(), {skip_rows, end_row})[0];
+
+    cudf_io::avro_reader_options opts =
+      cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath})
+        .skip_rows(skip_rows)
+        .num_rows(range.second);
+    auto const result = cudf_io::read_avro(opts);
+    cudf::test::expect_tables_equal(expected_rows, result.tbl->view());
+
+    auto const chunked = read_chunked(opts, 800);
+    cudf::test::expect_tables_equal(expected_rows, chunked->view());
+  }
+}
+
+TEST_F(AvroReaderTest, CorruptedSyncMarker)
+{
+  auto filepath = temp_env->get_temp_filepath("AvroCorruptedSyncMarker.avro");
+  auto const marker_offsets = write_avro_file(filepath, test_block_rows);
+  {
+    std::fstream file(filepath, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(marker_offsets[2] + 5);
+    file.put(0);
+  }
+
+  cudf_io::avro_reader_options opts =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath});
+  EXPECT_THROW(cudf_io::read_avro(opts), cudf::logic_error);
+
+  // The blocks before the corrupted marker can still be read
+  cudf_io::avro_reader_options head_opts =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath}).num_rows(1001);
+  auto const result = cudf_io::read_avro(head_opts);
+  cudf::test::expect_tables_equal(expected_table(1001)->view(), result.tbl->view());
+  cudf_io::avro_reader_options tail_opts =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath}).skip_rows(3000);
+  EXPECT_THROW(read_chunked(tail_opts, 1000), cudf::logic_error);
+}
+
+TEST_F(AvroReaderTest, ByteRange)
+{
+  auto filepath = temp_env->get_temp_filepath("AvroByteRange.avro");
+  auto const marker_offsets = write_avro_file(filepath, test_block_rows);
+  auto const expected       = expected_table(test_num_rows);
+  auto const file_size      = marker_offsets.back() + 16;
+
+  // Range boundaries before the first block, within blocks, on the first byte of a block and
+  // within a sync marker
+  std::vector<std::vector<size_t>> const range_splits{
+    {0, file_size},
+    {0, 10, file_size},
+    {0, 5000, 30000, file_size},
+    {0, marker_offsets[0] + 16, file_size},
+    {0, marker_offsets[1] + 8, file_size},
+    {0, marker_offsets[0] + 3, marker_offsets[3] + 20}};
+  for (auto const& splits : range_splits) {
+    std::vector<std::unique_ptr<cudf::table>> parts;
+    for (size_t i = 0; i + 1 < splits.size(); ++i) {
+      cudf_io::avro_reader_options opts =
+        cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath})
+          .byte_range_offset(splits[i])
+          .byte_range_size(splits[i + 1] - splits[i]);
+      auto result = cudf_io::read_avro(opts);
+      if (result.tbl->num_rows() != 0) { parts.push_back(std::move(result.tbl)); }
+    }
+    std::vector<cudf::table_view> views;
+    for (auto const& part : parts) { views.push_back(part->view()); }
+    auto const result = cudf::concatenate(views);
+    if (splits.back() == file_size) {
+      // Every block starts within exactly one of the ranges
+      cudf::test::expect_tables_equal(expected->view(), result->view());
+    } else {
+      // The blocks that start before the end of the last range; block `i + 1` starts right after
+      // the marker at `marker_offsets[i]`
+      auto const last_block =
+        std::lower_bound(marker_offsets.begin(), marker_offsets.end(), splits.back() - 16) -
+        marker_offsets.begin();
+      cudf::size_type num_rows = 0;
+      for (auto block = 0; block <= last_block; ++block) {
+        num_rows += static_cast<cudf::size_type>(test_block_rows[block]);
+      }
+      cudf::test::expect_tables_equal(cudf::slice(expected->view(), {0, num_rows})[0],
+                                      result->view());
+    }
+  }
+}
+
+TEST_F(AvroReaderTest, ParallelIndexing)
+{
+  // Large enough for the blocks of a whole file read to be indexed by several threads
+  constexpr size_t string_size = 4000;
+  std::vector<size_t> block_rows(80, 500);
+  block_rows[17] = 1;
+  block_rows[41] = 3000;
+  auto const num_rows = std::accumulate(block_rows.begin(), block_rows.end(), size_t{0});
+
+  auto filepath = temp_env->get_temp_filepath("AvroParallelIndexing.avro");
+  write_avro_file(filepath, block_rows, string_size);
+  auto const expected = expected_table(num_rows, string_size);
+
+  cudf_io::avro_reader_options opts =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath});
+  auto const result = cudf_io::read_avro(opts);
+  cudf::test::expect_tables_equal(expected->view(), result.tbl->view());
+
+  // Chunked reads index the blocks one after the other
+  auto const chunked = read_chunked(opts, 7000);
+  cudf::test::expect_tables_equal(expected->view(), chunked->view());
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 
+#include <io/comp/cpu_snap.h>
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
 
 #include <cudf_test/base_fixture.hpp>
 
@@ -172,4 +174,317 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+/**
+ * @brief Test fixture for batched host decompression
+ */
+struct HostDecompressTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Decompresses copies of the same block on the host and returns the per-block status.
+   */
+  std::vector<cudf::io::gpu_inflate_status_s> Decompress(int stream_type,
+                                                        std::vector<uint8_t> const& compressed,
+                                                        size_t decompressed_size,
+                                                        size_t num_blocks,
+                                                        std::vector<std::vector<uint8_t>>* outputs)
+  {
+    std::vector<std::vector<uint8_t>> inputs(num_blocks, compressed);
+    outputs->assign(num_blocks, std::vector<uint8_t>(decompressed_size));
+    // Corrupt the header of the first block
+    inputs[0][0] = 0;
+
+    std::vector<cudf::io::gpu_inflate_input_s> args(num_blocks);
+    for (size_t i = 0; i < num_blocks; ++i) {
+      args[i].srcDevice = inputs[i].data();
+      args[i].srcSize   = inputs[i].size();
+      args[i].dstDevice = (*outputs)[i].data();
+      args[i].dstSize   = (*outputs)[i].size();
+    }
+    std::vector<cudf::io::gpu_inflate_status_s> stats(num_blocks);
+    cudf::io::host_decompress(stream_type, args, stats);
+    return stats;
+  }
+};
+
+TEST_F(HostDecompressTest, GzipBatch)
+{
+  constexpr char uncompressed[] = "hello world";
+  std::vector<uint8_t> const compressed{
+    0x1f, 0x8b, 0x8,  0x0,  0x9,  0x63, 0x99, 0x5c, 0x2,  0xff, 0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57,
+    0x28, 0xcf, 0x2f, 0xca, 0x49, 0x1,  0x0,  0x85, 0x11, 0x4a, 0xd,  0xb,  0x0,  0x0,  0x0};
+  std::vector<uint8_t> const expected(uncompressed, uncompressed + strlen(uncompressed));
+
+  std::vector<std::vector<uint8_t>> outputs;
+  auto const stats = Decompress(
+    cudf::io::IO_UNCOMP_STREAM_TYPE_GZIP, compressed, expected.size(), 100, &outputs);
+  EXPECT_NE(stats[0].status, 0u);
+  for (size_t i = 1; i < stats.size(); ++i) {
+    EXPECT_EQ(stats[i].status, 0u);
+    EXPECT_EQ(stats[i].bytes_written, expected.size());
+    EXPECT_EQ(outputs[i], expected);
+  }
+}
+
+TEST_F(HostDecompressTest, SnappyBatch)
+{
+  constexpr char uncompressed[] = "hello world";
+  std::vector<uint8_t> const compressed{
+    0xb, 0x28, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+  std::vector<uint8_t> const expected(uncompressed, uncompressed + strlen(uncompressed));
+
+  std::vector<std::vector<uint8_t>> outputs;
+  auto const stats = Decompress(
+    cudf::io::IO_UNCOMP_STREAM_TYPE_SNAPPY, compressed, expected.size(), 100, &outputs);
+  EXPECT_NE(stats[0].status, 0u);
+  for (size_t i = 1; i < stats.size(); ++i) {
+    EXPECT_EQ(stats[i].status, 0u);
+    EXPECT_EQ(stats[i].bytes_written, expected.size());
+    EXPECT_EQ(outputs[i], expected);
+  }
+}
+
+TEST_F(HostDecompressTest, SnappyRoundTrip)
+{
+  // Long runs, short-offset repeats and literals, spanning multiple 64KB fragments
+  std::vector<uint8_t> input(200000);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = (i % 1000 < 100) ? static_cast<uint8_t>(i * 7919 >> 3) : "abcabd"[i % 6];
+  }
+  std::vector<uint8_t> compressed(cudf::io::cpu_snappy_max_compressed_size(input.size()));
+  compressed.resize(cudf::io::cpu_snappy_compress(input.data(), input.size(), compressed.data()));
+  EXPECT_LT(compressed.size(), input.size());
+
+  std::vector<std::vector<uint8_t>> outputs;
+  auto const stats = Decompress(
+    cudf::io::IO_UNCOMP_STREAM_TYPE_SNAPPY, compressed, input.size(), 2, &outputs);
+  EXPECT_EQ(stats[1].status, 0u);
+  EXPECT_EQ(outputs[1], input);
+}
+
+TEST_F(HostDecompressTest, Bzip2MultiStream)
+{
+  constexpr char uncompressed[] = "hello world";
+  std::vector<uint8_t> const stream{
+    0x42, 0x5a, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x44, 0xf7, 0x13, 0x78, 0x00, 0x00,
+    0x01, 0x91, 0x80, 0x40, 0x00, 0x06, 0x44, 0x90, 0x80, 0x20, 0x00, 0x22, 0x03, 0x34, 0x84, 0x30,
+    0x21, 0xb6, 0x81, 0x54, 0x27, 0x8b, 0xb9, 0x22, 0x9c, 0x28, 0x48, 0x22, 0x7b, 0x89, 0xbc, 0x00};
+  // Two concatenated bzip2 streams
+  std::vector<char> compressed(stream.begin(), stream.end());
+  compressed.insert(compressed.end(), stream.begin(), stream.end());
+
+  auto const output = cudf::io::get_uncompressed_data(compressed, "bz2");
+  EXPECT_EQ(std::string(output.begin(), output.end()),
+            std::string(uncompressed) + std::string(uncompressed));
+}
+
+TEST_F(HostDecompressTest, Bzip2MultiBlock)
+{
+  // 250000 bytes cycling through 20 characters, compressed with 100KB blocks (level 1) into three
+  // blocks. The characters are chosen so that the byte usage bitmaps of each block header contain
+  // the block signature, so that a false block signature follows each real one.
+  constexpr char cycle[] = "BCGIOQSTWZ]^acfgiklo";
+  std::string expected;
+  while (expected.size() < 250000) { expected += cycle; }
+  expected.resize(250000);
+  std::vector<uint8_t> const stream{
+    0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x4a, 0x5a, 0x00, 0x9c, 0x00,
+    0x09, 0xc3, 0x87, 0x00, 0x18, 0xa0, 0xac, 0x93, 0x29, 0xac, 0xb0, 0x00, 0xd9, 0x88, 0xa6,
+    0x13, 0x4d, 0x01, 0xa6, 0x20, 0x9a, 0xaa, 0x8c, 0x86, 0x13, 0x4d, 0x30, 0x0a, 0x55, 0x46,
+    0x43, 0x09, 0xa6, 0x98, 0x75, 0x50, 0x54, 0x78, 0x10, 0xa8, 0xf3, 0x50, 0x54, 0x61, 0x50,
+    0x54, 0x63, 0x50, 0x54, 0x7a, 0xa8, 0x2a, 0x3d, 0xd4, 0x15, 0x1f, 0x2a, 0x08, 0xac, 0x85,
+    0x50, 0xac, 0xc5, 0x50, 0xad, 0x05, 0x50, 0xad, 0x45, 0x50, 0xaf, 0xa2, 0xa8, 0x56, 0xc2,
+    0xa8, 0x57, 0xe1, 0x54, 0x2b, 0x71, 0x54, 0x2b, 0xf8, 0xaa, 0x15, 0xc0, 0xaa, 0x15, 0xc8,
+    0xaa, 0x15, 0xd1, 0x05, 0x47, 0x66, 0x28, 0x2b, 0x24, 0xca, 0x6b, 0x28, 0xac, 0x11, 0xe4,
+    0x40, 0x02, 0x70, 0xe0, 0xe0, 0x03, 0x14, 0x15, 0x92, 0x65, 0x35, 0x96, 0x00, 0x1b, 0x31,
+    0x14, 0xc2, 0x69, 0xa0, 0x34, 0xc4, 0x13, 0x55, 0x51, 0x90, 0xc2, 0x69, 0xa6, 0x01, 0x4a,
+    0xa8, 0xc8, 0x61, 0x34, 0xd3, 0x0e, 0xaa, 0x0a, 0x8f, 0x15, 0x05, 0x47, 0x91, 0x0a, 0x8c,
+    0x2a, 0x0a, 0x8c, 0x6a, 0x0a, 0x8f, 0x55, 0x05, 0x47, 0xba, 0x82, 0xa3, 0xe5, 0x41, 0x15,
+    0x90, 0xaa, 0x15, 0x98, 0xaa, 0x15, 0xa0, 0xaa, 0x15, 0xa8, 0xaa, 0x15, 0xf4, 0x55, 0x0a,
+    0xd8, 0x55, 0x0a, 0xfc, 0x2a, 0x85, 0x6e, 0x2a, 0x85, 0x7f, 0x15, 0x42, 0xb8, 0x15, 0x42,
+    0xb9, 0x15, 0x42, 0xba, 0x20, 0xa8, 0xec, 0xc5, 0x05, 0x64, 0x99, 0x4d, 0x66, 0x5d, 0xee,
+    0x8c, 0xe8, 0x00, 0x27, 0x14, 0x1c, 0x00, 0x62, 0x82, 0xb2, 0x4c, 0xa6, 0xb2, 0xc0, 0x02,
+    0xe0, 0x29, 0x84, 0xd3, 0x40, 0x69, 0x88, 0x53, 0x09, 0xa6, 0x80, 0xd3, 0x10, 0x29, 0x54,
+    0x8c, 0x46, 0x04, 0x32, 0x77, 0x21, 0x51, 0x84, 0x85, 0x46, 0x1e, 0x24, 0x2a, 0x3c, 0xa8,
+    0x54, 0x62, 0xa1, 0x51, 0x92, 0x85, 0x46, 0x6a, 0x15, 0x1e, 0x94, 0x2a, 0x3d, 0xa8, 0x54,
+    0x68, 0xa1, 0x51, 0xaa, 0x85, 0x46, 0xca, 0x15, 0x1b, 0xa8, 0x54, 0x70, 0xa1, 0x51, 0xca,
+    0x85, 0x47, 0xc5, 0x0a, 0x8f, 0xaa, 0x15, 0x1f, 0x94, 0x2a, 0x3a, 0x50, 0xa8, 0xed, 0x42,
+    0xa3, 0xf8, 0xbb, 0x92, 0x29, 0xc2, 0x84, 0x81, 0xa6, 0x95, 0xf8, 0x78};
+
+  std::vector<char> compressed(stream.begin(), stream.end());
+  auto const output = cudf::io::get_uncompressed_data(compressed, "bz2");
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+
+  // Followed by another stream, and decoded a window at a time
+  compressed.insert(compressed.end(), stream.begin(), stream.end());
+  auto decompressor = cudf::io::make_stream_decompressor(compressed, "bz2");
+  std::string streamed;
+  std::vector<char> window(30000);
+  while (not decompressor->eof()) {
+    streamed.append(window.data(), decompressor->read(window));
+  }
+  EXPECT_EQ(streamed, expected + expected);
+}
+
+TEST_F(HostDecompressTest, GzipMultiMember)
+{
+  constexpr char uncompressed[] = "hello world";
+  std::vector<uint8_t> const deflated{
+    0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x28, 0xcf, 0x2f, 0xca, 0x49, 0x1, 0x0};
+  std::vector<uint8_t> const trailer{0x85, 0x11, 0x4a, 0xd, 0xb, 0x0, 0x0, 0x0};
+  std::vector<uint8_t> const gzip_header{0x1f, 0x8b, 0x8, 0x0, 0x9, 0x63, 0x99, 0x5c, 0x2, 0xff};
+  // BGZF header, with the size of the member minus one in the "BC" extra subfield
+  std::vector<uint8_t> const bgzf_header{
+    0x1f, 0x8b, 0x8, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6, 0x0, 'B', 'C', 0x2, 0x0, 38, 0x0};
+
+  // Two BGZF members followed by a plain gzip member
+  std::vector<char> compressed;
+  for (auto const& header : {bgzf_header, bgzf_header, gzip_header}) {
+    compressed.insert(compressed.end(), header.begin(), header.end());
+    compressed.insert(compressed.end(), deflated.begin(), deflated.end());
+    compressed.insert(compressed.end(), trailer.begin(), trailer.end());
+  }
+  auto const expected =
+    std::string(uncompressed) + std::string(uncompressed) + std::string(uncompressed);
+
+  auto const output = cudf::io::get_uncompressed_data(compressed, "gzip");
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+
+  auto decompressor = cudf::io::make_stream_decompressor(compressed, "infer");
+  std::string streamed;
+  std::vector<char> window(5);
+  while (not decompressor->eof()) {
+    streamed.append(window.data(), decompressor->read(window));
+  }
+  EXPECT_EQ(streamed, expected);
+}
+
+TEST_F(HostDecompressTest, ZipMultiEntry)
+{
+  // Two DEFLATE entries, "a" holding "hello hello " and "b" holding "world world"
+  std::vector<uint8_t> const archive{
+    0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x50, 0x73, 0xa3,
+    0xb1, 0x9f, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x61, 0xcb,
+    0x48, 0xcd, 0xc9, 0xc9, 0x57, 0xc8, 0x00, 0x93, 0x00, 0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x50, 0x58, 0x7c, 0x63, 0x41, 0x0a, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x62, 0x2b, 0xcf, 0x2f, 0xca, 0x49, 0x51, 0x28, 0x07,
+    0x91, 0x00, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x21, 0x50, 0x73, 0xa3, 0xb1, 0x9f, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x61, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21,
+    0x50, 0x58, 0x7c, 0x63, 0x41, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x29, 0x00, 0x00, 0x00, 0x62,
+    0x50, 0x4b, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x52, 0x00, 0x00, 0x00, 0x00, 0x00};
+  std::vector<char> const compressed(archive.begin(), archive.end());
+  std::string const expected = "hello hello world world";
+
+  // The entries are concatenated, in order
+  auto const output = cudf::io::get_uncompressed_data(compressed, "zip");
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+
+  auto decompressor = cudf::io::make_stream_decompressor(compressed, "infer");
+  std::string streamed;
+  std::vector<char> window(5);
+  while (not decompressor->eof()) {
+    streamed.append(window.data(), decompressor->read(window));
+  }
+  EXPECT_EQ(streamed, expected);
+}
+
+TEST_F(HostDecompressTest, ZstdLz4RoundTrip)
+{
+  std::vector<uint8_t> input(200000);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = (i % 1000 < 100) ? static_cast<uint8_t>(i * 7919 >> 3) : "abcabd"[i % 6];
+  }
+  for (int stream_type :
+       {cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD, cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4}) {
+    std::vector<uint8_t> compressed(input.size());
+    std::vector<cudf::io::gpu_inflate_input_s> args(1);
+    std::vector<cudf::io::gpu_inflate_status_s> comp_stats(1);
+    args[0].srcDevice = input.data();
+    args[0].srcSize   = input.size();
+    args[0].dstDevice = compressed.data();
+    args[0].dstSize   = compressed.size();
+    cudf::io::host_compress(stream_type, args, comp_stats);
+    ASSERT_EQ(comp_stats[0].status, 0u);
+    EXPECT_LT(comp_stats[0].bytes_written, input.size());
+    compressed.resize(comp_stats[0].bytes_written);
+
+    std::vector<std::vector<uint8_t>> outputs;
+    auto const stats = Decompress(stream_type, compressed, input.size(), 2, &outputs);
+    EXPECT_EQ(stats[1].status, 0u);
+    EXPECT_EQ(stats[1].bytes_written, input.size());
+    EXPECT_EQ(outputs[1], input);
+  }
+}
+
+TEST_F(HostDecompressTest, Lz4HadoopFraming)
+{
+  constexpr char uncompressed[] = "hello world";
+  // Raw LZ4 block holding a single literal run
+  std::vector<uint8_t> const block{
+    0xb0, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+  // Two blocks, each preceded by its big-endian uncompressed size and holding a single chunk
+  // preceded by its big-endian compressed size
+  std::vector<uint8_t> framed;
+  for (int i = 0; i < 2; ++i) {
+    framed.insert(framed.end(), {0, 0, 0, 11, 0, 0, 0, 12});
+    framed.insert(framed.end(), block.begin(), block.end());
+  }
+  auto const expected = std::string(uncompressed) + std::string(uncompressed);
+
+  auto decompressor =
+    cudf::io::HostDecompressor::Create(cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP);
+  std::vector<uint8_t> output(expected.size());
+  EXPECT_EQ(decompressor->Decompress(output.data(), output.size(), framed.data(), framed.size()),
+            expected.size());
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+
+  // A single block holding two chunks, followed by an empty block
+  std::vector<uint8_t> multi_chunk{0, 0, 0, 22};
+  for (int i = 0; i < 2; ++i) {
+    multi_chunk.insert(multi_chunk.end(), {0, 0, 0, 12});
+    multi_chunk.insert(multi_chunk.end(), block.begin(), block.end());
+  }
+  multi_chunk.insert(multi_chunk.end(), {0, 0, 0, 0});
+  std::fill(output.begin(), output.end(), 0);
+  EXPECT_EQ(decompressor->Decompress(
+              output.data(), output.size(), multi_chunk.data(), multi_chunk.size()),
+            expected.size());
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+
+  // Unframed blocks are decoded as raw LZ4
+  EXPECT_EQ(decompressor->Decompress(output.data(), output.size(), block.data(), block.size()),
+            block.size() - 1);
+  EXPECT_EQ(std::string(output.begin(), output.begin() + block.size() - 1),
+            std::string(uncompressed));
+}
+
+TEST_F(HostDecompressTest, ZstdMultiFrame)
+{
+  constexpr char uncompressed[] = "hello world";
+  std::vector<uint8_t> frame(256);
+  frame.resize(cudf::io::HostCompressor::Create(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD)
+                 ->Compress(frame.data(),
+                            frame.size(),
+                            reinterpret_cast<uint8_t const*>(uncompressed),
+                            strlen(uncompressed)));
+  ASSERT_GT(frame.size(), 0u);
+  // Two concatenated frames
+  std::vector<char> compressed(frame.begin(), frame.end());
+  compressed.insert(compressed.end(), frame.begin(), frame.end());
+  auto const expected = std::string(uncompressed) + std::string(uncompressed);
+
+  auto const output = cudf::io::get_uncompressed_data(compressed, "infer");
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+
+  auto decompressor = cudf::io::make_stream_decompressor(compressed, "zstd");
+  std::string streamed;
+  std::vector<char> window(5);
+  while (not decompressor->eof()) {
+    streamed.append(window.data(), decompressor->read(window));
+  }
+  EXPECT_EQ(streamed, expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -30,6 +30,8 @@
 
 #include <arrow/io/api.h>
 
+#include <zlib.h>
+
 #include <algorithm>
 #include <fstream>
 #include <iostream>
@@ -882,6 +884,185 @@ TEST_F(CsvReaderTest, ByteRangeStrings)
   expect_column_data_equal(std::vector<std::string>{"c"}, view.column(0));
 }
 
+TEST_F(CsvReaderTest, ByteRangeWithHeader)
+{
+  std::string input = "A,B\n1,10\n2,20\n3,30\n4,40\n";
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{input.c_str(), input.size()})
+      .dtypes({"int32", "int32"})
+      .byte_range_offset(10)
+      .byte_range_size(10);
+  auto result = cudf_io::read_csv(in_opts);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(2, view.num_columns());
+  EXPECT_EQ("A", result.metadata.column_names[0]);
+  EXPECT_EQ("B", result.metadata.column_names[1]);
+  expect_column_data_equal(std::vector<int32_t>{3, 4}, view.column(0));
+  expect_column_data_equal(std::vector<int32_t>{30, 40}, view.column(1));
+
+  // The skipped rows precede the header, so they are not skipped again within the range; rows
+  // before the end of the header are excluded from a range that starts among them
+  std::string skip_input = "skip\nA,B\n1,10\n2,20\n3,30\n4,40\n";
+  auto read_range        = [&](size_t offset, size_t size) {
+    cudf_io::csv_reader_options skip_opts =
+      cudf_io::csv_reader_options::builder(
+        cudf_io::source_info{skip_input.c_str(), skip_input.size()})
+        .dtypes({"int32", "int32"})
+        .skiprows(1)
+        .byte_range_offset(offset)
+        .byte_range_size(size);
+    auto skip_result = cudf_io::read_csv(skip_opts);
+    EXPECT_EQ("A", skip_result.metadata.column_names[0]);
+    EXPECT_EQ("B", skip_result.metadata.column_names[1]);
+    auto const values = cudf::test::to_host<int32_t>(skip_result.tbl->view().column(0)).first;
+    return std::vector<int32_t>(values.begin(), values.end());
+  };
+  EXPECT_EQ((std::vector<int32_t>{3, 4}), read_range(15, 10));
+  EXPECT_EQ((std::vector<int32_t>{1}), read_range(2, 10));
+  EXPECT_EQ((std::vector<int32_t>{2, 3, 4}), read_range(12, skip_input.size() - 12));
+  EXPECT_EQ((std::vector<int32_t>{}), read_range(1, 5));
+}
+
+TEST_F(CsvReaderTest, PlanByteRanges)
+{
+  std::string input = "A\n";
+  for (int i = 0; i < 1000; ++i) { input += std::to_string(i) + "\n"; }
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{input.c_str(), input.size()})
+      .dtypes({"int32"});
+
+  auto const ranges = cudf_io::plan_csv_byte_ranges(in_opts, 7);
+  ASSERT_EQ(7u, ranges.size());
+  std::vector<int32_t> values;
+  size_t expected_offset = 0;
+  for (auto const& range : ranges) {
+    EXPECT_EQ(expected_offset, range.first);
+    expected_offset += range.second;
+
+    in_opts.set_byte_range_offset(range.first);
+    in_opts.set_byte_range_size(range.second);
+    auto result = cudf_io::read_csv(in_opts);
+    EXPECT_EQ("A", result.metadata.column_names[0]);
+    auto const column = cudf::test::to_host<int32_t>(result.tbl->view().column(0));
+    values.insert(values.end(), column.first.begin(), column.first.end());
+  }
+  EXPECT_EQ(input.size(), expected_offset);
+
+  std::vector<int32_t> expected(1000);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(expected, values);
+}
+
+TEST_F(CsvReaderTest, InferSchemaFromSample)
+{
+  std::string input = "A,B,C\n";
+  for (int i = 0; i < 1000; ++i) {
+    input += std::to_string(i) + "," + std::to_string(i * 0.5) + ",abc\n";
+  }
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{input.c_str(), input.size()});
+
+  cudf_io::schema_sampling_options sampling;
+  sampling.num_samples  = 4;
+  sampling.sample_bytes = 256;
+  auto const schema     = cudf_io::infer_csv_schema(in_opts, sampling);
+  EXPECT_EQ(schema.column_names, (std::vector<std::string>{"A", "B", "C"}));
+  EXPECT_EQ(schema.dtypes, (std::vector<std::string>{"A:int64", "B:float64", "C:str"}));
+
+  in_opts.set_dtypes(schema.dtypes);
+  auto result = cudf_io::read_csv(in_opts);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(3, view.num_columns());
+  EXPECT_EQ(1000, view.num_rows());
+  EXPECT_EQ(cudf::type_id::INT64, view.column(0).type().id());
+  EXPECT_EQ(cudf::type_id::FLOAT64, view.column(1).type().id());
+  EXPECT_EQ(cudf::type_id::STRING, view.column(2).type().id());
+}
+
+/**
+ * @brief Source over a host buffer that records the end of the furthest read made from it
+ */
+class read_end_recording_source : public cudf_io::datasource {
+  std::vector<char> const& _data;
+
+ public:
+  size_t max_read_end = 0;
+
+  explicit read_end_recording_source(std::vector<char> const& data) : _data(data) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const read_size = record_read(offset, size);
+    return std::make_unique<non_owning_buffer>(
+      reinterpret_cast<uint8_t*>(const_cast<char*>(_data.data())) + offset, read_size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const read_size = record_read(offset, size);
+    std::copy(_data.cbegin() + offset, _data.cbegin() + offset + read_size, dst);
+    return read_size;
+  }
+
+  size_t size() const override { return _data.size(); }
+
+ private:
+  size_t record_read(size_t offset, size_t size)
+  {
+    offset               = std::min(offset, _data.size());
+    auto const read_size = std::min(size, _data.size() - offset);
+    max_read_end         = std::max(max_read_end, offset + read_size);
+    return read_size;
+  }
+};
+
+TEST_F(CsvReaderTest, InferSchemaFromCompressedSample)
+{
+  std::string csv = "A,B\n";
+  for (int i = 0; i < 100000; ++i) {
+    csv += std::to_string(i) + "," + std::to_string(i * 0.25) + "\n";
+  }
+
+  z_stream strm{};
+  ASSERT_EQ(deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY),
+            Z_OK);
+  std::vector<char> gz(deflateBound(&strm, csv.size()));
+  strm.next_in   = reinterpret_cast<Bytef*>(&csv[0]);
+  strm.avail_in  = csv.size();
+  strm.next_out  = reinterpret_cast<Bytef*>(gz.data());
+  strm.avail_out = gz.size();
+  ASSERT_EQ(deflate(&strm, Z_FINISH), Z_STREAM_END);
+  gz.resize(strm.total_out);
+  deflateEnd(&strm);
+
+  cudf_io::schema_sampling_options sampling;
+  sampling.num_samples  = 4;
+  sampling.sample_bytes = 256;
+
+  read_end_recording_source source(gz);
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{&source})
+      .compression(cudf_io::compression_type::GZIP);
+  auto const schema = cudf_io::infer_csv_schema(in_opts, sampling);
+  EXPECT_EQ(schema.column_names, (std::vector<std::string>{"A", "B"}));
+  EXPECT_EQ(schema.dtypes, (std::vector<std::string>{"A:int64", "B:float64"}));
+  // Only a prefix of the compressed data is read to fill the sample
+  EXPECT_GT(source.max_read_end, 0);
+  EXPECT_LT(source.max_read_end, gz.size() / 10);
+
+  // A sample larger than the whole dataset reads all of it
+  sampling.sample_bytes = csv.size();
+  read_end_recording_source whole_source(gz);
+  cudf_io::csv_reader_options whole_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{&whole_source})
+      .compression(cudf_io::compression_type::GZIP);
+  auto const whole_schema = cudf_io::infer_csv_schema(whole_opts, sampling);
+  EXPECT_EQ(whole_schema.dtypes, schema.dtypes);
+  EXPECT_EQ(whole_source.max_read_end, gz.size());
+}
+
 TEST_F(CsvReaderTest, BlanksAndComments)
 {
   auto filepath = temp_env->get_temp_dir() + "BlanksAndComments.csv";
@@ -1032,6 +1213,41 @@ TEST_F(CsvReaderTest, SkipRowsXorSkipFooter)
   EXPECT_NO_THROW(cudf_io::read_csv(skipfooter_options));
 }
 
+TEST_F(CsvReaderTest, GzipSkipRowsAndNrows)
+{
+  std::string csv = "a,b\n";
+  for (int i = 0; i < 1000; ++i) { csv += std::to_string(i) + "," + std::to_string(2 * i) + "\n"; }
+
+  z_stream strm{};
+  ASSERT_EQ(deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY),
+            Z_OK);
+  std::vector<char> gz(deflateBound(&strm, csv.size()));
+  strm.next_in   = reinterpret_cast<Bytef*>(&csv[0]);
+  strm.avail_in  = csv.size();
+  strm.next_out  = reinterpret_cast<Bytef*>(gz.data());
+  strm.avail_out = gz.size();
+  ASSERT_EQ(deflate(&strm, Z_FINISH), Z_STREAM_END);
+  gz.resize(strm.total_out);
+  deflateEnd(&strm);
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{gz.data(), gz.size()})
+      .compression(cudf_io::compression_type::GZIP)
+      .dtypes({"int32", "int32"})
+      .header(-1)
+      .skiprows(101)
+      .nrows(10);
+  const auto result = cudf_io::read_csv(in_opts);
+  const auto view   = result.tbl->view();
+  ASSERT_EQ(2, view.num_columns());
+
+  std::vector<int32_t> a(10), b(10);
+  std::iota(a.begin(), a.end(), 100);
+  std::transform(a.begin(), a.end(), b.begin(), [](auto i) { return 2 * i; });
+  expect_column_data_equal(a, view.column(0));
+  expect_column_data_equal(b, view.column(1));
+}
+
 TEST_F(CsvReaderTest, nullHandling)
 {
   const auto filepath = temp_env->get_temp_dir() + "NullValues.csv";
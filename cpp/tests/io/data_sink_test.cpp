@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/io/data_sink.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+// Size of each of the two buffers of file sinks
+constexpr size_t sink_buffer_size = 8 * 1024 * 1024;
+
+struct DataSinkTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Returns data with a pattern that differs at every offset
+   */
+  static std::vector<uint8_t> make_data(size_t size)
+  {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) { data[i] = static_cast<uint8_t>(i ^ (i >> 8) ^ (i >> 16)); }
+    return data;
+  }
+
+  static std::vector<uint8_t> read_file(std::string const& filepath)
+  {
+    std::ifstream in(filepath, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), {});
+  }
+
+  /**
+   * @brief Writes the data in pieces of the given sizes, checking the written byte count
+   */
+  static void write_pieces(cudf_io::data_sink& sink,
+                           std::vector<uint8_t> const& data,
+                           std::vector<size_t> const& sizes)
+  {
+    size_t offset = sink.bytes_written();
+    for (auto const size : sizes) {
+      ASSERT_LE(offset + size, data.size());
+      sink.host_write(data.data() + offset, size);
+      offset += size;
+      EXPECT_EQ(sink.bytes_written(), offset);
+    }
+  }
+};
+
+TEST_F(DataSinkTest, FileWritesAcrossBufferSwaps)
+{
+  auto const filepath = temp_env->get_temp_filepath("FileWritesAcrossBufferSwaps.bin");
+  auto const data     = make_data(5 * sink_buffer_size + 12345);
+
+  // Piece sizes that fill a buffer exactly, end just before or after a buffer boundary, span
+  // several buffers, and bypass the buffers while buffered data is pending
+  std::vector<size_t> const sizes{1,
+                                  sink_buffer_size - 1,
+                                  sink_buffer_size - 10,
+                                  20,
+                                  100,
+                                  sink_buffer_size,
+                                  4096,
+                                  2 * sink_buffer_size - 4096 - 110,
+                                  12345};
+  ASSERT_EQ(std::accumulate(sizes.begin(), sizes.end(), size_t{0}), data.size());
+  {
+    auto sink = cudf_io::data_sink::create(filepath);
+    write_pieces(*sink, data, sizes);
+    sink->flush();
+    EXPECT_EQ(read_file(filepath), data);
+  }
+  EXPECT_EQ(read_file(filepath), data);
+}
+
+TEST_F(DataSinkTest, FileManySmallWrites)
+{
+  auto const filepath = temp_env->get_temp_filepath("FileManySmallWrites.bin");
+  auto const data     = make_data(2 * sink_buffer_size + 777);
+
+  // Uneven sizes, so that the buffer boundaries fall within the pieces
+  std::vector<size_t> sizes;
+  for (size_t total = 0; total < data.size(); total += sizes.back()) {
+    sizes.push_back(std::min<size_t>(1 + (sizes.size() * 7919) % 65521, data.size() - total));
+  }
+  {
+    auto sink = cudf_io::data_sink::create(filepath);
+    write_pieces(*sink, data, sizes);
+  }
+  EXPECT_EQ(read_file(filepath), data);
+}
+
+TEST_F(DataSinkTest, FileSyncPolicies)
+{
+  auto const data = make_data(sink_buffer_size + 1000);
+
+  for (auto const policy : {cudf_io::file_sync_policy::NONE,
+                            cudf_io::file_sync_policy::ON_CLOSE,
+                            cudf_io::file_sync_policy::ON_FLUSH}) {
+    auto const filepath = temp_env->get_temp_filepath(
+      "FileSyncPolicies" + std::to_string(static_cast<int>(policy)) + ".bin");
+    {
+      auto sink = cudf_io::data_sink::create(filepath, policy);
+      write_pieces(*sink, data, {1000});
+      sink->flush();
+      // Flushed data is in the file with every policy
+      EXPECT_EQ(read_file(filepath), std::vector<uint8_t>(data.begin(), data.begin() + 1000));
+
+      write_pieces(*sink, data, {sink_buffer_size});
+      sink->flush();
+      EXPECT_EQ(read_file(filepath), data);
+      // Flushing without new data leaves the file unchanged
+      sink->flush();
+      EXPECT_EQ(sink->bytes_written(), data.size());
+    }
+    EXPECT_EQ(read_file(filepath), data);
+  }
+}
+
+TEST_F(DataSinkTest, FileSinkWithoutWrites)
+{
+  auto const filepath = temp_env->get_temp_filepath("FileSinkWithoutWrites.bin");
+  {
+    auto sink = cudf_io::data_sink::create(filepath, cudf_io::file_sync_policy::ON_FLUSH);
+    sink->flush();
+    EXPECT_EQ(sink->bytes_written(), 0);
+  }
+  EXPECT_TRUE(read_file(filepath).empty());
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/io/datasource.hpp>
+
+#include <io/utilities/prefetching_source.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+// Size of the windows mapped by the memory mapped source
+constexpr size_t window_size = 64 * 1024 * 1024;
+
+struct DatasourceTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Writes a file of the given size, with a pattern that differs at every offset
+   */
+  static std::vector<uint8_t> write_file(std::string const& filepath, size_t size)
+  {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) { data[i] = static_cast<uint8_t>(i ^ (i >> 8) ^ (i >> 16)); }
+    std::ofstream out(filepath, std::ios::binary);
+    out.write(reinterpret_cast<char const*>(data.data()), data.size());
+    return data;
+  }
+
+  /**
+   * @brief Reads a range with both `host_read` overloads and compares it to the expected data
+   */
+  static void expect_range(cudf_io::datasource& source,
+                           std::vector<uint8_t> const& expected,
+                           size_t offset,
+                           size_t size)
+  {
+    auto const expected_size = (offset < expected.size())
+                                 ? std::min(size, expected.size() - offset)
+                                 : 0;
+    auto const begin = expected.cbegin() + std::min(offset, expected.size());
+
+    auto const buffer = source.host_read(offset, size);
+    ASSERT_EQ(buffer->size(), expected_size);
+    EXPECT_TRUE(std::equal(begin, begin + expected_size, buffer->data()));
+
+    std::vector<uint8_t> dst(size);
+    ASSERT_EQ(source.host_read(offset, size, dst.data()), expected_size);
+    EXPECT_TRUE(std::equal(begin, begin + expected_size, dst.cbegin()));
+  }
+};
+
+TEST_F(DatasourceTest, MemoryMappedWindowedReads)
+{
+  auto const filepath = temp_env->get_temp_filepath("MemoryMappedWindowedReads.bin");
+  auto const expected = write_file(filepath, 4 * 1024 * 1024 + 123);
+
+  // Reads are limited to the range passed on creation
+  auto const range_source = cudf_io::datasource::create(
+    filepath, 1024 * 1024, 4096, cudf_io::file_read_mode::MEMORY_MAPPED);
+  ASSERT_EQ(range_source->size(), expected.size());
+  auto const range_data = std::vector<uint8_t>(expected.cbegin(), expected.cbegin() + 1028 * 1024);
+  expect_range(*range_source, range_data, 1024 * 1024, 4096);
+  expect_range(*range_source, range_data, 1024 * 1024 + 100, 100);
+  // Clamped to the end of the range
+  expect_range(*range_source, range_data, 1024 * 1024 + 4000, 1000);
+  EXPECT_THROW(range_source->host_read(0, 100), cudf::logic_error);
+
+  auto const source =
+    cudf_io::datasource::create(filepath, 0, 0, cudf_io::file_read_mode::MEMORY_MAPPED);
+  expect_range(*source, expected, 1024 * 1024, 4096);
+  expect_range(*source, expected, 0, 100);
+  expect_range(*source, expected, 12345, 2 * 1024 * 1024);
+  expect_range(*source, expected, 0, expected.size());
+  // Reads past the end of the file are clamped
+  expect_range(*source, expected, expected.size() - 10, 100);
+  expect_range(*source, expected, expected.size() + 10, 100);
+
+  // Buffers remain valid after the source is destroyed
+  auto buffer = cudf_io::datasource::create(filepath, 0, 0, cudf_io::file_read_mode::MEMORY_MAPPED)
+                  ->host_read(100, 1000);
+  EXPECT_TRUE(std::equal(expected.cbegin() + 100, expected.cbegin() + 1100, buffer->data()));
+}
+
+TEST_F(DatasourceTest, MemoryMappedReadsAcrossWindows)
+{
+  auto const filepath = temp_env->get_temp_filepath("MemoryMappedReadsAcrossWindows.bin");
+  auto const expected = write_file(filepath, window_size + 1024 * 1024);
+
+  auto const source =
+    cudf_io::datasource::create(filepath, 0, 0, cudf_io::file_read_mode::MEMORY_MAPPED);
+  // Maps the first window of the file
+  expect_range(*source, expected, 0, 100);
+  // Starts within the first window and ends past it
+  expect_range(*source, expected, window_size - 100, 200);
+  expect_range(*source, expected, window_size - 4096, 2 * 1024 * 1024);
+  // Within the first window again, and within the last part of the file only
+  expect_range(*source, expected, window_size / 2, 1000);
+  expect_range(*source, expected, window_size + 100, 1000);
+}
+
+TEST_F(DatasourceTest, EmptyFile)
+{
+  auto const filepath = temp_env->get_temp_filepath("DatasourceEmptyFile.bin");
+  auto const expected = write_file(filepath, 0);
+
+  for (auto mode : {cudf_io::file_read_mode::MEMORY_MAPPED, cudf_io::file_read_mode::POSITIONAL}) {
+    auto const source = cudf_io::datasource::create(filepath, 0, 0, mode);
+    EXPECT_EQ(source->size(), 0);
+    expect_range(*source, expected, 0, 100);
+  }
+}
+
+TEST_F(DatasourceTest, MissingFile)
+{
+  auto const filepath = temp_env->get_temp_filepath("DatasourceMissingFile.bin");
+  EXPECT_THROW(cudf_io::datasource::create(filepath, 0, 0, cudf_io::file_read_mode::MEMORY_MAPPED),
+               cudf::logic_error);
+  EXPECT_THROW(cudf_io::datasource::create(filepath, 0, 0, cudf_io::file_read_mode::POSITIONAL),
+               cudf::logic_error);
+}
+
+/**
+ * @brief In-memory source that records the reads made from it
+ */
+class recording_source : public cudf_io::datasource {
+  std::vector<uint8_t> const _data;
+  std::mutex _mutex;
+  std::vector<std::pair<size_t, size_t>> _reads;
+
+ public:
+  explicit recording_source(std::vector<uint8_t> data) : _data(std::move(data)) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto data = std::make_shared<std::vector<uint8_t>>(size);
+    data->resize(host_read(offset, size, data->data()));
+    struct vector_buffer : public buffer {
+      std::shared_ptr<std::vector<uint8_t>> _data;
+      size_t size() const override { return _data->size(); }
+      const uint8_t* data() const override { return _data->data(); }
+    };
+    auto result   = std::make_unique<vector_buffer>();
+    result->_data = std::move(data);
+    return result;
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _reads.emplace_back(offset, size);
+    }
+    auto const read_size = (offset < _data.size()) ? std::min(size, _data.size() - offset) : 0;
+    std::copy(_data.cbegin() + offset, _data.cbegin() + offset + read_size, dst);
+    return read_size;
+  }
+
+  size_t size() const override { return _data.size(); }
+
+  /**
+   * @brief Returns whether a read of the given range has been made
+   */
+  bool was_read(size_t offset, size_t size)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return std::find(_reads.cbegin(), _reads.cend(), std::make_pair(offset, size)) != _reads.cend();
+  }
+};
+
+std::vector<uint8_t> make_pattern(size_t size)
+{
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; ++i) { data[i] = static_cast<uint8_t>(i ^ (i >> 8)); }
+  return data;
+}
+
+TEST_F(DatasourceTest, PrefetchedReads)
+{
+  auto const expected = make_pattern(100000);
+  cudf_io::detail::prefetching_source source(
+    std::make_unique<recording_source>(expected), 100, 10000, 30000);
+
+  // Ranges within the gap limit are coalesced; the ranges are not given in order
+  source.prefetch({{50000, 5000}, {0, 1000}, {1050, 950}, {20000, 8000}, {99000, 5000}});
+
+  expect_range(source, expected, 0, 500);
+  // Spans the gap between two coalesced ranges
+  expect_range(source, expected, 900, 300);
+  // Starts within a fetch and ends past it
+  expect_range(source, expected, 27000, 2000);
+  // Outside of any hinted range
+  expect_range(source, expected, 40000, 100);
+  expect_range(source, expected, 50000, 5000);
+  // Clamped to the end of the source
+  expect_range(source, expected, 99500, 1000);
+}
+
+/**
+ * @brief Reads a range once, so that it is consumed once from the prefetched data
+ */
+void expect_single_read(cudf_io::datasource& source,
+                        std::vector<uint8_t> const& expected,
+                        size_t offset,
+                        size_t size)
+{
+  auto const buffer = source.host_read(offset, size);
+  ASSERT_EQ(buffer->size(), size);
+  EXPECT_TRUE(std::equal(expected.cbegin() + offset, expected.cbegin() + offset + size,
+                         buffer->data()));
+}
+
+TEST_F(DatasourceTest, PrefetchReleasesConsumedFetches)
+{
+  auto const expected = make_pattern(10000);
+  auto recording      = std::make_unique<recording_source>(expected);
+  auto& reads         = *recording;
+  // One fetch per range; the limit allows one fetch in flight
+  cudf_io::detail::prefetching_source source(std::move(recording), 0, 1000, 1500);
+  source.prefetch({{0, 1000}, {2000, 1000}, {4000, 1000}});
+
+  // A fetch holds its budget until all of its bytes are consumed
+  expect_single_read(source, expected, 0, 500);
+  expect_single_read(source, expected, 500, 500);
+  expect_single_read(source, expected, 2000, 100);
+  EXPECT_TRUE(reads.was_read(0, 1000));
+  EXPECT_TRUE(reads.was_read(2000, 1000));
+  EXPECT_FALSE(reads.was_read(2000, 100));
+
+  expect_single_read(source, expected, 2100, 900);
+  expect_single_read(source, expected, 4000, 1000);
+  EXPECT_TRUE(reads.was_read(4000, 1000));
+
+  // Released fetches no longer serve reads
+  expect_single_read(source, expected, 100, 100);
+  EXPECT_TRUE(reads.was_read(100, 100));
+}
+
+TEST_F(DatasourceTest, PrefetchOverlappingHints)
+{
+  auto const expected = make_pattern(10000);
+  auto recording      = std::make_unique<recording_source>(expected);
+  auto& reads         = *recording;
+  cudf_io::detail::prefetching_source source(std::move(recording), 0, 10000, 1500);
+
+  // Overlapping and repeated ranges are fetched, and counted, once
+  source.prefetch({{0, 1000}, {500, 1000}, {0, 1000}});
+  expect_single_read(source, expected, 0, 1000);
+  expect_single_read(source, expected, 1000, 500);
+  EXPECT_TRUE(reads.was_read(0, 1500));
+
+  // The fetch is released once its bytes are consumed, so that the next one can start
+  source.prefetch({{5000, 1500}});
+  expect_single_read(source, expected, 5000, 10);
+  EXPECT_TRUE(reads.was_read(5000, 1500));
+  EXPECT_FALSE(reads.was_read(5000, 10));
+}
+
+TEST_F(DatasourceTest, PrefetchReplacesHints)
+{
+  auto const expected = make_pattern(10000);
+  auto recording      = std::make_unique<recording_source>(expected);
+  auto& reads         = *recording;
+  cudf_io::detail::prefetching_source source(std::move(recording), 0, 1000, 1000);
+
+  // New hints release the fetches of the previous ones, even if they were not consumed
+  source.prefetch({{0, 1000}});
+  source.prefetch({{0, 1000}});
+  source.prefetch({{3000, 1000}});
+  expect_single_read(source, expected, 3000, 10);
+  EXPECT_TRUE(reads.was_read(3000, 1000));
+  EXPECT_FALSE(reads.was_read(3000, 10));
+  expect_single_read(source, expected, 0, 10);
+  EXPECT_TRUE(reads.was_read(0, 10));
+}
+
+TEST_F(DatasourceTest, PrefetchOnlyCopyingSources)
+{
+  auto const filepath = temp_env->get_temp_filepath("PrefetchOnlyCopyingSources.bin");
+  write_file(filepath, 1000);
+
+  // Memory mapped reads are zero-copy, and are not read ahead into intermediate buffers
+  auto mapped = cudf_io::detail::make_prefetching_source(
+    cudf_io::datasource::create(filepath, 0, 0, cudf_io::file_read_mode::MEMORY_MAPPED));
+  EXPECT_TRUE(mapped->supports_zero_copy_host_read());
+  EXPECT_EQ(dynamic_cast<cudf_io::detail::prefetching_source*>(mapped.get()), nullptr);
+
+  auto positional = cudf_io::detail::make_prefetching_source(
+    cudf_io::datasource::create(filepath, 0, 0, cudf_io::file_read_mode::POSITIONAL));
+  EXPECT_FALSE(positional->supports_zero_copy_host_read());
+  EXPECT_NE(dynamic_cast<cudf_io::detail::prefetching_source*>(positional.get()), nullptr);
+}
+
+TEST_F(DatasourceTest, PrefetchWithinLimitOnly)
+{
+  auto const expected = make_pattern(10000);
+  auto recording      = std::make_unique<recording_source>(expected);
+  auto& reads         = *recording;
+  cudf_io::detail::prefetching_source source(std::move(recording), 0, 1000, 1000);
+  source.prefetch({{0, 1000}, {2000, 1000}});
+
+  // The second fetch exceeds the limit until more of the first one is consumed; reading its data
+  // before then reads it directly
+  expect_single_read(source, expected, 0, 100);
+  expect_single_read(source, expected, 2000, 100);
+  EXPECT_TRUE(reads.was_read(0, 1000));
+  EXPECT_TRUE(reads.was_read(2000, 100));
+  EXPECT_FALSE(reads.was_read(2000, 1000));
+}
+
+CUDF_TEST_PROGRAM_MAIN()
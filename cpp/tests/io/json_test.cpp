@@ -232,6 +232,32 @@ TEST_F(JsonReaderTest, JsonLinesStrings)
                                  cudf::test::strings_column_wrapper({"aa ", "  bbb"}));
 }
 
+TEST_F(JsonReaderTest, InferSchemaFromSample)
+{
+  std::string data;
+  for (int i = 0; i < 1000; ++i) { data += "[" + std::to_string(i) + ", 1.5, \"abc\"]\n"; }
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true);
+
+  cudf_io::schema_sampling_options sampling;
+  sampling.num_samples  = 4;
+  sampling.sample_bytes = 256;
+  auto const schema     = cudf_io::infer_json_schema(in_options, sampling);
+  EXPECT_EQ(schema.column_names, (std::vector<std::string>{"0", "1", "2"}));
+  EXPECT_EQ(schema.dtypes, (std::vector<std::string>{"0:int64", "1:float64", "2:str"}));
+
+  in_options.dtypes(schema.dtypes);
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  EXPECT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.tbl->num_rows(), 1000);
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::INT64);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::FLOAT64);
+  EXPECT_EQ(result.tbl->get_column(2).type().id(), cudf::type_id::STRING);
+}
+
 TEST_F(JsonReaderTest, MultiColumn)
 {
   constexpr auto num_rows = 10;
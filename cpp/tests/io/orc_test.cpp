@@ -29,6 +29,11 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <io/orc/orc.h>
+#include <io/orc/timezone.cuh>
+
+#include <cstdlib>
+#include <memory>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -502,6 +507,77 @@ TEST_F(OrcWriterTest, Strings)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, HostCodecs)
+{
+  // Compressed on the host; enough rows for several compression blocks per stream
+  constexpr auto num_rows = 100000;
+  std::vector<const char*> strings{"Monday", "Tuesday", "Wednesday", "Thursday", "Friday"};
+  auto seq_col0 = random_values<int64_t>(num_rows);
+  auto seq_col2 = random_values<double>(num_rows);
+  auto str_iter = cudf::test::make_counting_transform_iterator(
+    0, [&](auto i) { return strings[(i / 7) % strings.size()]; });
+  auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+
+  column_wrapper<int64_t> col0{seq_col0.begin(), seq_col0.end(), validity};
+  column_wrapper<cudf::string_view> col1{str_iter, str_iter + num_rows};
+  column_wrapper<double> col2{seq_col2.begin(), seq_col2.end(), validity};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  for (auto const compression : {cudf_io::compression_type::ZSTD, cudf_io::compression_type::LZ4}) {
+    auto filepath = temp_env->get_temp_filepath("OrcHostCodecs.orc");
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected->view())
+        .compression(compression);
+    cudf_io::write_orc(out_opts);
+
+    // With and without the row index, which is compressed as well
+    for (bool use_index : {false, true}) {
+      cudf_io::orc_reader_options in_opts =
+        cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).use_index(use_index);
+      auto result = cudf_io::read_orc(in_opts);
+
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+    }
+  }
+}
+
+TEST_F(OrcWriterTest, HostDecompression)
+{
+  // SNAPPY compressed, which has a device decoder
+  constexpr auto num_rows = 100000;
+  std::vector<const char*> strings{"Monday", "Tuesday", "Wednesday", "Thursday", "Friday"};
+  auto seq_col0 = random_values<int64_t>(num_rows);
+  auto str_iter = cudf::test::make_counting_transform_iterator(
+    0, [&](auto i) { return strings[(i / 7) % strings.size()]; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  column_wrapper<int64_t> col0{seq_col0.begin(), seq_col0.end(), validity};
+  column_wrapper<cudf::string_view> col1{str_iter, str_iter + num_rows};
+  auto expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("HostDecompression.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .compression(cudf_io::compression_type::SNAPPY);
+  cudf_io::write_orc(out_opts);
+
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+  setenv("LIBCUDF_HOST_DECOMPRESSION", "ON", 1);
+  auto result = cudf_io::read_orc(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  setenv("LIBCUDF_HOST_DECOMPRESSION", "YES", 1);
+  EXPECT_THROW(cudf_io::read_orc(in_opts), cudf::logic_error);
+  unsetenv("LIBCUDF_HOST_DECOMPRESSION");
+}
+
 TEST_F(OrcWriterTest, SlicedTable)
 {
   // This test checks for writing zero copy, offseted views into existing cudf tables
@@ -829,6 +905,101 @@ TEST_F(OrcChunkedWriterTest, ReadStripesError)
   EXPECT_THROW(cudf_io::read_orc(read_opts), cudf::logic_error);
 }
 
+TEST_F(OrcChunkedWriterTest, FilterStripes)
+{
+  // Each table is written as a separate stripe. The stripes hold disjoint ranges of values and
+  // strings, and the second column only holds nulls in the first stripe.
+  constexpr auto num_rows = 1000;
+  auto sequence1 =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return int64_t(i); });
+  auto sequence2 =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return int64_t(num_rows + i); });
+  auto str_iter1 = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "apple" + std::to_string(i); });
+  auto str_iter2 = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "melon" + std::to_string(i); });
+  auto validity  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  auto all_nulls = cudf::test::make_counting_transform_iterator(0, [](auto i) { return false; });
+
+  column_wrapper<int64_t> col0_1(sequence1, sequence1 + num_rows, validity);
+  column_wrapper<int64_t> col1_1(sequence1, sequence1 + num_rows, all_nulls);
+  column_wrapper<cudf::string_view> col2_1(str_iter1, str_iter1 + num_rows, validity);
+  column_wrapper<int64_t> col0_2(sequence2, sequence2 + num_rows, validity);
+  column_wrapper<int64_t> col1_2(sequence2, sequence2 + num_rows, validity);
+  column_wrapper<cudf::string_view> col2_2(str_iter2, str_iter2 + num_rows, validity);
+  auto table1 = table_view{{col0_1, col1_1, col2_1}};
+  auto table2 = table_view{{col0_2, col1_2, col2_2}};
+
+  auto full_table = cudf::concatenate({table1, table2});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedFilterStripes.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  auto state = cudf_io::write_orc_chunked_begin(opts);
+  cudf_io::write_orc_chunked(table1, state);
+  cudf_io::write_orc_chunked(table2, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  // Filter on the values
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+      .filter(cudf_io::filter_expression::compare(
+        "_col0", cudf_io::filter_op::GREATER_EQUAL, int64_t{num_rows + 500}));
+  auto result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table2);
+
+  // Each stripe matches one of the filters
+  read_opts.set_filter(cudf_io::filter_expression::any_of(
+    {cudf_io::filter_expression::compare("_col0", cudf_io::filter_op::LESS, 10),
+     cudf_io::filter_expression::compare("_col0", cudf_io::filter_op::EQUAL, num_rows)}));
+  result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
+
+  // Unsigned literals, such as sizes
+  read_opts.set_filter(cudf_io::filter_expression::compare(
+    "_col0", cudf_io::filter_op::GREATER_EQUAL, static_cast<uint32_t>(num_rows)));
+  result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table2);
+
+  // Filter on the strings
+  read_opts.set_filter(
+    cudf_io::filter_expression::compare("_col2", cudf_io::filter_op::LESS, "banana"));
+  result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table1);
+
+  read_opts.set_filter(
+    cudf_io::filter_expression::compare("_col2", cudf_io::filter_op::GREATER_EQUAL, "melon5"));
+  result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table2);
+
+  // Filters on the column with nulls; comparisons never match nulls
+  read_opts.set_filter(cudf_io::filter_expression::compare("_col1", cudf_io::filter_op::IS_NULL));
+  result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table1);
+
+  read_opts.set_filter(
+    cudf_io::filter_expression::compare("_col1", cudf_io::filter_op::IS_NOT_NULL));
+  result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table2);
+
+  read_opts.set_filter(
+    cudf_io::filter_expression::compare("_col1", cudf_io::filter_op::LESS, int64_t{num_rows}));
+  result = cudf_io::read_orc(read_opts);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  // All stripes are filtered out; the columns are still returned
+  read_opts.set_filter(cudf_io::filter_expression::all_of(
+    {cudf_io::filter_expression::compare("_col0", cudf_io::filter_op::LESS, num_rows),
+     cudf_io::filter_expression::compare("_col2", cudf_io::filter_op::GREATER, "melon")}));
+  result = cudf_io::read_orc(read_opts);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  ASSERT_EQ(result.tbl->num_columns(), table1.num_columns());
+  for (cudf::size_type i = 0; i < table1.num_columns(); ++i) {
+    EXPECT_EQ(result.tbl->get_column(i).type(), table1.column(i).type());
+  }
+  EXPECT_EQ(result.metadata.column_names, std::vector<std::string>({"_col0", "_col1", "_col2"}));
+}
+
 TYPED_TEST(OrcChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -941,4 +1112,216 @@ TEST_F(OrcReaderTest, CombinedSkipRowTest)
   skip_row.test(2, 100, 110);
 }
 
+TEST_F(OrcReaderTest, SkipRowsWithIndex)
+{
+  // Several row groups of the default row index stride, with nulls and strings
+  constexpr auto num_rows = 100000;
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto strings  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "str" + std::to_string(i % 1000); });
+  column_wrapper<int32_t, typename decltype(sequence)::value_type> col0(
+    sequence, sequence + num_rows, validity);
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows, validity);
+  auto expected = table_view{{col0, col1}};
+
+  // Single stripe files, and files of three stripes starting at rows 0, 25000 and 55000, so that
+  // the row groups of the later stripes start within the default row index stride
+  std::vector<cudf::size_type> const stripe_splits{25000, 55000};
+  auto const stripes = cudf::split(expected, stripe_splits);
+  for (auto const compression :
+       {cudf_io::compression_type::SNAPPY, cudf_io::compression_type::NONE}) {
+    auto filepath = temp_env->get_temp_filepath("SkipRowsWithIndex.orc");
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+        .compression(compression);
+    cudf_io::write_orc(out_opts);
+
+    auto multi_filepath = temp_env->get_temp_filepath("SkipRowsWithIndexStripes.orc");
+    cudf_io::chunked_orc_writer_options multi_opts =
+      cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{multi_filepath})
+        .compression(compression);
+    auto state = cudf_io::write_orc_chunked_begin(multi_opts);
+    for (auto const& stripe : stripes) { cudf_io::write_orc_chunked(stripe, state); }
+    cudf_io::write_orc_chunked_end(state);
+
+    // Windows starting at and within row groups, within later stripes, and spanning stripes
+    for (auto const& window : std::vector<std::pair<int, int>>{{0, 5000},
+                                                               {10000, 10000},
+                                                               {25000, 30000},
+                                                               {12345, 100},
+                                                               {99990, 10},
+                                                               {27500, 5000},
+                                                               {36789, 20000},
+                                                               {57345, 10},
+                                                               {70001, 29999}}) {
+      for (auto const& path : {filepath, multi_filepath}) {
+        cudf_io::orc_reader_options in_opts =
+          cudf_io::orc_reader_options::builder(cudf_io::source_info{path})
+            .use_index(true)
+            .skip_rows(window.first)
+            .num_rows(window.second);
+        auto result = cudf_io::read_orc(in_opts);
+
+        auto expected_window =
+          cudf::slice(expected, {window.first, window.first + window.second}).front();
+        CUDF_TEST_EXPECT_TABLES_EQUAL(expected_window, result.tbl->view());
+      }
+    }
+  }
+}
+
+TEST_F(OrcReaderTest, MultipleFiles)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 7, true);
+
+  auto filepath1 = temp_env->get_temp_filepath("MultipleFiles1.orc");
+  auto filepath2 = temp_env->get_temp_filepath("MultipleFiles2.orc");
+  cudf_io::orc_writer_options out_opts1 =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath1}, table1->view());
+  cudf_io::write_orc(out_opts1);
+  cudf_io::orc_writer_options out_opts2 =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath2}, table2->view());
+  cudf_io::write_orc(out_opts2);
+
+  cudf_io::orc_reader_options read_opts = cudf_io::orc_reader_options::builder(
+    cudf_io::source_info{std::vector<std::string>{filepath1, filepath2}});
+  auto result = cudf_io::read_orc(read_opts);
+
+  auto expected = cudf::concatenate({*table1, *table2});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+  read_opts.set_num_rows(3);
+  EXPECT_THROW(cudf_io::read_orc(read_opts), cudf::logic_error);
+}
+
+TEST_F(OrcReaderTest, MultipleFilesMismatchedSchemas)
+{
+  srand(31337);
+  auto int_table    = create_random_fixed_table<int>(3, 5, true);
+  auto int_table2   = create_random_fixed_table<int>(2, 5, true);
+  auto float_table  = create_random_fixed_table<float>(3, 5, true);
+  auto write_source = [](std::string const& name,
+                         cudf::table_view const& table,
+                         cudf_io::table_metadata const* metadata) {
+    auto filepath = temp_env->get_temp_filepath(name);
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, table).metadata(metadata);
+    cudf_io::write_orc(out_opts);
+    return filepath;
+  };
+  cudf_io::table_metadata renamed;
+  renamed.column_names = {"a", "b", "c"};
+
+  auto const ints      = write_source("MismatchedSchemas1.orc", int_table->view(), nullptr);
+  auto const floats    = write_source("MismatchedSchemas2.orc", float_table->view(), nullptr);
+  auto const fewer     = write_source("MismatchedSchemas3.orc", int_table2->view(), nullptr);
+  auto const different = write_source("MismatchedSchemas4.orc", int_table->view(), &renamed);
+
+  for (auto const& other : {floats, fewer, different}) {
+    cudf_io::orc_reader_options read_opts = cudf_io::orc_reader_options::builder(
+      cudf_io::source_info{std::vector<std::string>{ints, other}});
+    EXPECT_THROW(cudf_io::read_orc(read_opts), cudf::logic_error);
+  }
+
+  // Selecting the columns that match by name is allowed
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(
+      cudf_io::source_info{std::vector<std::string>{different, different}})
+      .columns({"b", "c"});
+  auto result = cudf_io::read_orc(read_opts);
+  auto const expected_cols =
+    cudf::concatenate({int_table->view().select({1, 2}), int_table->view().select({1, 2})});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected_cols);
+}
+
+TEST_F(OrcReaderTest, PreloadTimezones)
+{
+  EXPECT_NO_THROW(cudf_io::preload_orc_timezones({"UTC", "America/Los_Angeles"}));
+  auto const table = cudf_io::get_host_timezone_table("America/Los_Angeles");
+  ASSERT_NE(table, nullptr);
+  EXPECT_FALSE(table->ttimes.empty());
+  // Cached tables are reused
+  EXPECT_NO_THROW(cudf_io::preload_orc_timezones({"America/Los_Angeles"}));
+  EXPECT_EQ(cudf_io::get_host_timezone_table("America/Los_Angeles"), table);
+  EXPECT_THROW(cudf_io::preload_orc_timezones({"Not/A_Timezone"}), cudf::logic_error);
+}
+
+TEST_F(OrcReaderTest, StatisticsViewsOutliveMetadata)
+{
+  namespace orc = cudf::io::orc;
+
+  orc::Metadata metadata;
+  metadata.stripeStats.resize(2);
+  std::vector<std::vector<uint8_t>> blobs{{1, 2, 3}, {}, {4, 5}, {6}};
+  for (size_t i = 0; i < blobs.size(); ++i) {
+    metadata.stripeStats[i / 2].colStats.emplace_back(std::vector<uint8_t>(blobs[i]));
+  }
+  auto encoded = std::make_shared<std::vector<uint8_t>>();
+  orc::ProtobufWriter(encoded.get()).write(metadata);
+  auto const encoded_size = encoded->size();
+
+  // The decoded blobs view the encoded buffer, whose only other owner is the reader
+  orc::Metadata decoded;
+  {
+    orc::ProtobufReader pb;
+    pb.init(std::shared_ptr<const std::vector<uint8_t>>(std::move(encoded)));
+    ASSERT_TRUE(pb.read(decoded, encoded_size));
+  }
+  auto const copied = decoded;
+  auto const moved  = std::move(decoded);
+  decoded           = orc::Metadata{};
+
+  for (auto const* md : {&copied, &moved}) {
+    ASSERT_EQ(md->stripeStats.size(), 2);
+    for (size_t i = 0; i < blobs.size(); ++i) {
+      auto const& blob = md->stripeStats[i / 2].colStats[i % 2];
+      EXPECT_EQ(std::vector<uint8_t>(blob.begin(), blob.end()), blobs[i]);
+    }
+  }
+}
+
+TEST_F(OrcReaderTest, FileFooterViewsOutliveBuffer)
+{
+  namespace orc = cudf::io::orc;
+
+  orc::FileFooter footer;
+  footer.types.resize(3);
+  footer.types[0].kind       = orc::STRUCT;
+  footer.types[0].subtypes   = {1, 2};
+  footer.types[0].fieldNames = {"a", "b"};
+  footer.types[1].kind       = orc::LONG;
+  footer.types[2].kind       = orc::STRING;
+  std::vector<std::vector<uint8_t>> blobs{{}, {1, 2, 3}, {4, 5}};
+  for (auto const& blob : blobs) { footer.statistics.emplace_back(std::vector<uint8_t>(blob)); }
+  auto encoded = std::make_shared<std::vector<uint8_t>>();
+  orc::ProtobufWriter(encoded.get()).write(footer);
+  auto const encoded_size = encoded->size();
+  std::weak_ptr<std::vector<uint8_t>> const buffer = encoded;
+
+  orc::FileFooter decoded;
+  {
+    orc::ProtobufReader pb;
+    pb.init(std::shared_ptr<const std::vector<uint8_t>>(std::move(encoded)));
+    ASSERT_TRUE(pb.read(decoded, encoded_size));
+  }
+  // The source buffer is released by its owner, but kept alive by the statistics views
+  EXPECT_FALSE(buffer.expired());
+  ASSERT_EQ(decoded.statistics.size(), blobs.size());
+  for (size_t i = 0; i < blobs.size(); ++i) {
+    auto const& blob = decoded.statistics[i];
+    EXPECT_EQ(std::vector<uint8_t>(blob.begin(), blob.end()), blobs[i]);
+  }
+
+  // The rest of the footer does not reference the buffer
+  decoded.statistics.clear();
+  EXPECT_TRUE(buffer.expired());
+  ASSERT_EQ(decoded.types.size(), 3);
+  EXPECT_EQ(decoded.types[0].kind, orc::STRUCT);
+  EXPECT_EQ(decoded.types[0].fieldNames, (std::vector<std::string>{"a", "b"}));
+  EXPECT_EQ(decoded.types[2].kind, orc::STRING);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -29,9 +29,18 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <io/parquet/compact_protocol_writer.hpp>
+#include <io/parquet/parquet.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -428,6 +437,74 @@ TEST_F(ParquetWriterTest, Strings)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(ParquetWriterTest, HostCodecs)
+{
+  // Compressed on the host; enough rows for several pages per column
+  constexpr auto num_rows = 100000;
+  std::vector<const char*> strings{"Monday", "Tuesday", "Wednesday", "Thursday", "Friday"};
+  auto seq_col0 = random_values<int64_t>(num_rows);
+  auto seq_col2 = random_values<double>(num_rows);
+  auto str_iter = cudf::test::make_counting_transform_iterator(
+    0, [&](auto i) { return strings[(i / 7) % strings.size()]; });
+  auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+
+  column_wrapper<int64_t> col0{seq_col0.begin(), seq_col0.end(), validity};
+  column_wrapper<cudf::string_view> col1{str_iter, str_iter + num_rows};
+  column_wrapper<double> col2{seq_col2.begin(), seq_col2.end(), validity};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  for (auto const compression : {cudf_io::compression_type::ZSTD, cudf_io::compression_type::LZ4}) {
+    auto filepath = temp_env->get_temp_filepath("HostCodecs.parquet");
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected->view())
+        .compression(compression);
+    cudf_io::write_parquet(out_opts);
+
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+    auto result = cudf_io::read_parquet(in_opts);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+  }
+}
+
+TEST_F(ParquetWriterTest, HostDecompression)
+{
+  // SNAPPY compressed, which has a device decoder
+  constexpr auto num_rows = 100000;
+  std::vector<const char*> strings{"Monday", "Tuesday", "Wednesday", "Thursday", "Friday"};
+  auto seq_col0 = random_values<int64_t>(num_rows);
+  auto str_iter = cudf::test::make_counting_transform_iterator(
+    0, [&](auto i) { return strings[(i / 7) % strings.size()]; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  column_wrapper<int64_t> col0{seq_col0.begin(), seq_col0.end(), validity};
+  column_wrapper<cudf::string_view> col1{str_iter, str_iter + num_rows};
+  auto expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("HostDecompression.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .compression(cudf_io::compression_type::SNAPPY);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  setenv("LIBCUDF_HOST_DECOMPRESSION", "ON", 1);
+  auto result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  setenv("LIBCUDF_HOST_DECOMPRESSION", "YES", 1);
+  EXPECT_THROW(cudf_io::read_parquet(in_opts), cudf::logic_error);
+  unsetenv("LIBCUDF_HOST_DECOMPRESSION");
+}
+
 TEST_F(ParquetWriterTest, SlicedTable)
 {
   // This test checks for writing zero copy, offseted views into existing cudf tables
@@ -672,6 +749,114 @@ TEST_F(ParquetWriterTest, HostBuffer)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(ParquetWriterTest, FileReadModes)
+{
+  constexpr auto num_rows = 100 << 10;
+  const auto seq_col      = random_values<int>(num_rows);
+  const auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  column_wrapper<int> col{seq_col.begin(), seq_col.end(), validity};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("FileReadModes.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected->view());
+  cudf_io::write_parquet(out_opts);
+
+  for (auto mode : {cudf_io::file_read_mode::MEMORY_MAPPED,
+                    cudf_io::file_read_mode::POSITIONAL,
+                    cudf_io::file_read_mode::DIRECT}) {
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath, mode});
+    const auto result = cudf_io::read_parquet(in_opts);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+  }
+}
+
+TEST_F(ParquetWriterTest, MetadataCache)
+{
+  constexpr auto num_rows = 10 << 10;
+  const auto seq_col0     = random_values<int>(num_rows);
+  const auto seq_col1     = random_values<double>(num_rows);
+  const auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  column_wrapper<int> col0{seq_col0.begin(), seq_col0.end(), validity};
+  column_wrapper<double> col1{seq_col1.begin(), seq_col1.end(), validity};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("col0");
+  expected_metadata.column_names.emplace_back("col1");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("MetadataCache.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected->view())
+      .metadata(&expected_metadata);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::clear_parquet_metadata_cache();
+  const auto initial = cudf_io::get_parquet_metadata_cache_stats();
+
+  // The first read parses the footer, the following ones reuse it
+  for (auto const &column : expected_metadata.column_names) {
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .columns({column})
+        .use_metadata_cache(true);
+    const auto result = cudf_io::read_parquet(in_opts);
+    EXPECT_EQ(result.metadata.column_names, std::vector<std::string>{column});
+  }
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .use_metadata_cache(true);
+  const auto result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+
+  const auto stats = cudf_io::get_parquet_metadata_cache_stats();
+  EXPECT_EQ(stats.misses - initial.misses, 1u);
+  EXPECT_EQ(stats.hits - initial.hits, 2u);
+  EXPECT_EQ(stats.num_entries, 1u);
+
+  cudf_io::clear_parquet_metadata_cache();
+  EXPECT_EQ(cudf_io::get_parquet_metadata_cache_stats().num_entries, 0u);
+}
+
+TEST_F(ParquetWriterTest, ChunkedHostBuffer)
+{
+  constexpr auto num_rows = 100 << 10;
+  const auto seq_col      = random_values<int>(num_rows);
+  const auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  column_wrapper<int> col{seq_col.begin(), seq_col.end(), validity};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  // Small chunks so that the output spans many of them
+  cudf_io::chunked_host_buffer out_buffer(4096);
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected->view());
+  cudf_io::write_parquet(out_opts);
+  EXPECT_GT(out_buffer.chunks().size(), 1u);
+
+  const auto flat = out_buffer.flatten();
+  EXPECT_EQ(flat.size(), out_buffer.size());
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info(flat.data(), flat.size()));
+  const auto result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+}
+
 TEST_F(ParquetWriterTest, NonNullable)
 {
   srand(31337);
@@ -878,6 +1063,105 @@ TEST_F(ParquetChunkedWriterTest, SimpleTable)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(ParquetChunkedWriterTest, FilterRowGroups)
+{
+  // Each table is written as a separate row group. The row groups hold disjoint ranges of values
+  // and strings, and the second column only holds nulls in the first row group.
+  constexpr auto num_rows = 1000;
+  auto sequence1 =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return int64_t(i); });
+  auto sequence2 =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return int64_t(num_rows + i); });
+  auto str_iter1 = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "apple" + std::to_string(i); });
+  auto str_iter2 = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "melon" + std::to_string(i); });
+  auto validity  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  auto all_nulls = cudf::test::make_counting_transform_iterator(0, [](auto i) { return false; });
+
+  column_wrapper<int64_t> col0_1(sequence1, sequence1 + num_rows, validity);
+  column_wrapper<int64_t> col1_1(sequence1, sequence1 + num_rows, all_nulls);
+  column_wrapper<cudf::string_view> col2_1(str_iter1, str_iter1 + num_rows, validity);
+  column_wrapper<int64_t> col0_2(sequence2, sequence2 + num_rows, validity);
+  column_wrapper<int64_t> col1_2(sequence2, sequence2 + num_rows, validity);
+  column_wrapper<cudf::string_view> col2_2(str_iter2, str_iter2 + num_rows, validity);
+  auto table1 = table_view{{col0_1, col1_1, col2_1}};
+  auto table2 = table_view{{col0_2, col1_2, col2_2}};
+
+  auto full_table = cudf::concatenate({table1, table2});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedFilterRowGroups.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(table1, state);
+  cudf_io::write_parquet_chunked(table2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  // Filter on the values
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .filter(cudf_io::filter_expression::compare(
+        "_col0", cudf_io::filter_op::GREATER_EQUAL, int64_t{num_rows + 500}));
+  auto result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table2);
+
+  // Each row group matches one of the filters
+  read_opts.set_filter(cudf_io::filter_expression::any_of(
+    {cudf_io::filter_expression::compare("_col0", cudf_io::filter_op::LESS, 10),
+     cudf_io::filter_expression::compare("_col0", cudf_io::filter_op::EQUAL, num_rows)}));
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
+
+  // Unsigned literals, such as sizes
+  read_opts.set_filter(cudf_io::filter_expression::compare(
+    "_col0", cudf_io::filter_op::LESS, static_cast<size_t>(num_rows)));
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table1);
+  EXPECT_THROW(cudf_io::filter_expression::compare(
+                 "_col0", cudf_io::filter_op::LESS, std::numeric_limits<uint64_t>::max()),
+               cudf::logic_error);
+
+  // Filter on the strings
+  read_opts.set_filter(
+    cudf_io::filter_expression::compare("_col2", cudf_io::filter_op::LESS, "banana"));
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table1);
+
+  read_opts.set_filter(
+    cudf_io::filter_expression::compare("_col2", cudf_io::filter_op::GREATER_EQUAL, "melon5"));
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table2);
+
+  // Filters on the column with nulls; comparisons never match nulls
+  read_opts.set_filter(
+    cudf_io::filter_expression::compare("_col1", cudf_io::filter_op::IS_NULL));
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table1);
+
+  read_opts.set_filter(
+    cudf_io::filter_expression::compare("_col1", cudf_io::filter_op::IS_NOT_NULL));
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table2);
+
+  read_opts.set_filter(
+    cudf_io::filter_expression::compare("_col1", cudf_io::filter_op::LESS, int64_t{num_rows}));
+  result = cudf_io::read_parquet(read_opts);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  // All row groups are filtered out; the columns are still returned
+  read_opts.set_filter(cudf_io::filter_expression::all_of(
+    {cudf_io::filter_expression::compare("_col0", cudf_io::filter_op::LESS, num_rows),
+     cudf_io::filter_expression::compare("_col2", cudf_io::filter_op::GREATER, "melon")}));
+  result = cudf_io::read_parquet(read_opts);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  ASSERT_EQ(result.tbl->num_columns(), table1.num_columns());
+  for (cudf::size_type i = 0; i < table1.num_columns(); ++i) {
+    EXPECT_EQ(result.tbl->get_column(i).type(), table1.column(i).type());
+  }
+  EXPECT_EQ(result.metadata.column_names, std::vector<std::string>({"_col0", "_col1", "_col2"}));
+}
+
 TEST_F(ParquetChunkedWriterTest, LargeTables)
 {
   srand(31337);
@@ -2105,4 +2389,198 @@ TEST_F(ParquetReaderTest, DecimalRead)
     EXPECT_THROW(cudf_io::read_parquet(read_opts), cudf::logic_error);
   }
 }
+
+/**
+ * @brief Adds an offset index and a column index to the column chunks of the given INT64 columns
+ * of a Parquet file, with the page statistics computed from the values of the columns
+ *
+ * The cuDF writer does not write page indexes; the indexes are appended after the column chunks
+ * and the footer is rewritten to point to them.
+ */
+void add_page_indexes(std::string const& filepath,
+                      std::map<std::string, std::vector<int64_t>> const& column_values)
+{
+  namespace pq = cudf::io::parquet;
+  std::vector<uint8_t> file;
+  {
+    std::ifstream in(filepath, std::ios::binary);
+    file.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+  constexpr size_t ender_len = 8;  // Footer length and "PAR1"
+  ASSERT_GT(file.size(), ender_len);
+  uint32_t footer_len = 0;
+  std::memcpy(&footer_len, file.data() + file.size() - ender_len, sizeof(footer_len));
+  pq::FileMetaData md;
+  pq::CompactProtocolReader cp(file.data() + file.size() - ender_len - footer_len, footer_len);
+  ASSERT_TRUE(cp.read(&md));
+  file.resize(file.size() - ender_len - footer_len);
+
+  auto const plain = [](int64_t value) {
+    return std::string(reinterpret_cast<char const*>(&value), sizeof(value));
+  };
+  pq::CompactProtocolWriter cpw(&file);
+  int64_t row_group_start = 0;
+  for (auto& row_group : md.row_groups) {
+    for (auto& chunk : row_group.columns) {
+      auto const values = column_values.find(chunk.meta_data.path_in_schema.back());
+      if (values == column_values.end()) { continue; }
+
+      pq::OffsetIndex offset_index;
+      pq::ColumnIndex column_index;
+      size_t pos = (chunk.meta_data.dictionary_page_offset != 0)
+                     ? chunk.meta_data.dictionary_page_offset
+                     : chunk.meta_data.data_page_offset;
+      auto const end = pos + chunk.meta_data.total_compressed_size;
+      int64_t row    = 0;
+      while (pos < end) {
+        pq::PageHeader header;
+        pq::CompactProtocolReader page_cp(file.data() + pos, end - pos);
+        ASSERT_TRUE(page_cp.read(&header));
+        auto const page_size = static_cast<int32_t>(page_cp.bytecount()) +
+                               header.compressed_page_size;
+        if (header.type == pq::PageType::DATA_PAGE) {
+          pq::PageLocation location;
+          location.offset               = pos;
+          location.compressed_page_size = page_size;
+          location.first_row_index      = row;
+          offset_index.page_locations.push_back(location);
+
+          auto const first  = values->second.cbegin() + row_group_start + row;
+          auto const last   = first + header.data_page_header.num_values;
+          auto const minmax = std::minmax_element(first, last);
+          column_index.null_pages.push_back(false);
+          column_index.min_values.push_back(plain(*minmax.first));
+          column_index.max_values.push_back(plain(*minmax.second));
+          row += header.data_page_header.num_values;
+        }
+        pos += page_size;
+      }
+      ASSERT_EQ(row, row_group.num_rows);
+
+      chunk.offset_index_offset = file.size();
+      chunk.offset_index_length = cpw.write(offset_index);
+      chunk.column_index_offset = file.size();
+      chunk.column_index_length = cpw.write(column_index);
+    }
+    row_group_start += row_group.num_rows;
+  }
+
+  std::vector<uint8_t> footer;
+  pq::CompactProtocolWriter footer_cpw(&footer);
+  footer_len = footer_cpw.write(md);
+  std::ofstream out(filepath, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<char const*>(file.data()), file.size());
+  out.write(reinterpret_cast<char const*>(footer.data()), footer.size());
+  out.write(reinterpret_cast<char const*>(&footer_len), sizeof(footer_len));
+  out.write("PAR1", 4);
+}
+
+TEST_F(ParquetReaderTest, FilterPagesAcrossRowGroups)
+{
+  // Three row groups, of several pages per column
+  constexpr int64_t rows_per_group = 200000;
+  constexpr int64_t num_rows       = 3 * rows_per_group;
+  std::vector<int64_t> a(num_rows);
+  std::vector<int64_t> b(num_rows);
+  std::vector<int32_t> c(num_rows);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    a[i] = i;
+    // Descending in the first row group, ascending in the second one, and 0 in the third one
+    b[i] = (i < rows_per_group) ? rows_per_group - 1 - i
+                                : (i < 2 * rows_per_group) ? i - rows_per_group : 0;
+    c[i] = static_cast<int32_t>(i * 3);
+  }
+
+  auto filepath = temp_env->get_temp_filepath("FilterPagesAcrossRowGroups.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (int64_t start = 0; start < num_rows; start += rows_per_group) {
+    column_wrapper<int64_t> col_a(a.begin() + start, a.begin() + start + rows_per_group);
+    column_wrapper<int64_t> col_b(b.begin() + start, b.begin() + start + rows_per_group);
+    column_wrapper<int32_t> col_c(c.begin() + start, c.begin() + start + rows_per_group);
+    cudf_io::write_parquet_chunked(table_view{{col_a, col_b, col_c}}, state);
+  }
+  cudf_io::write_parquet_chunked_end(state);
+  // The third column has no page index, so its column chunks are read whole
+  add_page_indexes(filepath, {{"_col0", a}, {"_col1", b}});
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto const full = cudf_io::read_parquet(read_opts);
+
+  // Both row groups 0 and 1 pass the row group statistics. In row group 0 no page matches both
+  // conditions, and in row group 1 only the last pages of the second column match.
+  read_opts.set_filter(cudf_io::filter_expression::all_of(
+    {cudf_io::filter_expression::compare(
+       "_col0", cudf_io::filter_op::GREATER_EQUAL, rows_per_group - 1),
+     cudf_io::filter_expression::compare(
+       "_col1", cudf_io::filter_op::GREATER_EQUAL, rows_per_group - 1000)}));
+  auto const filtered = cudf_io::read_parquet(read_opts);
+
+  // The rows of the matching pages end with row group 1
+  auto const filtered_rows = filtered.tbl->num_rows();
+  auto const end_row       = static_cast<cudf::size_type>(2 * rows_per_group);
+  EXPECT_GE(filtered_rows, 1000);
+  EXPECT_LT(filtered_rows, rows_per_group);
+  auto const expected = cudf::slice(full.tbl->view(), {end_row - filtered_rows, end_row})[0];
+  CUDF_TEST_EXPECT_TABLES_EQUAL(filtered.tbl->view(), expected);
+}
+
+TEST_F(ParquetReaderTest, PageIndexRowRanges)
+{
+  // Two row groups; the first column has several pages per column chunk, and the second one is
+  // dictionary encoded, with a dictionary page before its data pages
+  constexpr int64_t rows_per_group = 500000;
+  constexpr int64_t num_rows       = 2 * rows_per_group;
+  std::vector<int64_t> a(num_rows);
+  std::vector<int64_t> b(num_rows);
+  std::vector<int32_t> c(num_rows);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    a[i] = i;
+    b[i] = i % 100;
+    c[i] = static_cast<int32_t>(i * 3);
+  }
+
+  auto filepath = temp_env->get_temp_filepath("PageIndexRowRanges.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (int64_t start = 0; start < num_rows; start += rows_per_group) {
+    column_wrapper<int64_t> col_a(a.begin() + start, a.begin() + start + rows_per_group);
+    column_wrapper<int64_t> col_b(b.begin() + start, b.begin() + start + rows_per_group);
+    column_wrapper<int32_t> col_c(c.begin() + start, c.begin() + start + rows_per_group);
+    cudf_io::write_parquet_chunked(table_view{{col_a, col_b, col_c}}, state);
+  }
+  cudf_io::write_parquet_chunked_end(state);
+  // The third column has no page index, so its column chunks are read whole
+  add_page_indexes(filepath, {{"_col0", a}, {"_col1", b}});
+
+  cudf_io::parquet_reader_options full_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto const full = cudf_io::read_parquet(full_opts);
+
+  auto const expect_rows = [&](cudf::size_type skip_rows, cudf::size_type num_rows) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .skip_rows(skip_rows)
+        .num_rows(num_rows);
+    auto const result = cudf_io::read_parquet(read_opts);
+    auto const end_row =
+      (num_rows < 0) ? full.tbl->num_rows() : std::min(skip_rows + num_rows, full.tbl->num_rows());
+    auto const expected = cudf::slice(full.tbl->view(), {skip_rows, end_row})[0];
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected);
+  };
+
+  // Skipping into the middle of a page, to the end of the file
+  expect_rows(300001, -1);
+  // Ending in the middle of the first row group
+  expect_rows(0, 200001);
+  // Starting and ending in the middle of pages of the first row group; the pages of the second
+  // column that are skipped follow its dictionary page
+  expect_rows(300001, 100000);
+  // Crossing the boundary between the row groups
+  expect_rows(rows_per_group - 12345, 54321);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
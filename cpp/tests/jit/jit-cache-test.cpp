@@ -16,6 +16,10 @@
 
 #include "jit-cache-test.hpp"
 
+#include <ctime>
+#include <fstream>
+#include <thread>
+
 namespace cudf {
 namespace test {
 TEST_F(JitCacheTest, CacheExceptionTest)
@@ -34,17 +38,15 @@ TEST_F(JitCacheTest, MemoryCacheKernelTest)
   auto column = cudf::test::fixed_width_column_wrapper<int>{{5, 0}};
   auto expect = cudf::test::fixed_width_column_wrapper<int>{{125, 0}};
 
-  // make new program and rename it to match old program
-  auto program = getProgram("MemoryCacheTestProg1", program2_source);
-  // TODO: when I convert this pair to a class, make an inherited test class that can edit names
-  std::get<0>(program) = "MemoryCacheTestProg";
-
-  // remove any file cache so below kernel should not be obtained from file
+  // remove any file cache so below kernel can only be obtained from memory
   purgeFileCache();
 
-  // make kernel that if the cache tried to compile, will use a different
-  // program than intended and give wrong result.
-  auto kernel = getKernelInstantiation("my_kernel", program, {"3", "int"});
+  auto program = getProgram("MemoryCacheTestProg", program_source);
+  auto kernel  = getKernelInstantiation("my_kernel", program, {"3", "int"});
+  // same kernel as the one instantiated in warmUp()
+  auto kernel2 = getKernelInstantiation(
+    "my_kernel", getProgram("MemoryCacheTestProg", program_source), {"3", "int"});
+  EXPECT_EQ(std::get<1>(kernel), std::get<1>(kernel2));
 
   (*std::get<1>(kernel))
     .configure(grid, block)
@@ -53,6 +55,30 @@ TEST_F(JitCacheTest, MemoryCacheKernelTest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, column);
 }
 
+TEST_F(JitCacheTest, MemoryCacheSameNameTest)
+{
+  // Programs of the same name but of different sources or options are cached separately
+
+  // Single value column
+  auto column = cudf::test::fixed_width_column_wrapper<int>{{5, 0}};
+  auto expect = cudf::test::fixed_width_column_wrapper<int>{{15, 0}};
+
+  auto program = getProgram("MemoryCacheTestProg", program2_source);
+  auto kernel  = getKernelInstantiation("my_kernel", program, {"3", "int"});
+  (*std::get<1>(kernel))
+    .configure(grid, block)
+    .launch(column.operator cudf::mutable_column_view().data<int>());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, column);
+
+  auto program_with_options =
+    getProgram("MemoryCacheTestProg", program_source, {}, {"-DMEMORY_CACHE_SAME_NAME_TEST"});
+  EXPECT_NE(std::get<0>(program_with_options),
+            std::get<0>(getProgram("MemoryCacheTestProg", program_source)));
+  EXPECT_NE(std::get<1>(program_with_options),
+            std::get<1>(getProgram("MemoryCacheTestProg", program_source)));
+}
+
 TEST_F(JitCacheTest, MemoryCacheProgramTest)
 {
   // Check program source caching
@@ -76,6 +102,26 @@ TEST_F(JitCacheTest, MemoryCacheProgramTest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, column);
 }
 
+TEST_F(JitCacheTest, ConcurrentKernelTest)
+{
+  // Concurrent requests for the same kernel should share a single compiled kernel
+  purgeFileCache();
+  cudf::jit::cudfJitCache cache;
+
+  std::vector<std::shared_ptr<jitify::experimental::KernelInstantiation>> kernels(8);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < kernels.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      EXPECT_EQ(cudaSuccess, cudaSetDevice(0));
+      auto program = cache.getProgram("ConcurrentTestProg", program_source);
+      kernels[i]   = std::get<1>(cache.getKernelInstantiation("my_kernel", program, {"3", "int"}));
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  for (auto const& kernel : kernels) { EXPECT_EQ(kernel, kernels.front()); }
+}
+
 // Test the file caching ability
 #if defined(JITIFY_USE_CACHE)
 TEST_F(JitCacheTest, FileCacheProgramTest)
@@ -117,6 +163,46 @@ TEST_F(JitCacheTest, FileCacheKernelTest)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, column);
 }
+
+TEST_F(JitCacheTest, FileCacheLimitTest)
+{
+  purgeFileCache();
+  setenv("LIBCUDF_KERNEL_CACHE_LIMIT", "1", 1);
+  cudf::jit::cudfJitCache cache;
+
+  // Every new file evicts the previous ones once the limit is exceeded
+  auto program  = cache.getProgram("FileCacheLimitTestProg", program_source);
+  auto program2 = cache.getProgram("FileCacheLimitTestProg2", program2_source);
+  unsetenv("LIBCUDF_KERNEL_CACHE_LIMIT");
+
+  auto const cache_dir = cudf::jit::getCacheDir();
+  EXPECT_EQ(std::distance(boost::filesystem::directory_iterator(cache_dir),
+                          boost::filesystem::directory_iterator()),
+            1);
+}
+
+TEST_F(JitCacheTest, FileCacheStaleTempFileTest)
+{
+  purgeFileCache();
+  auto const cache_dir = cudf::jit::getCacheDir();
+  // Temporary files left behind by a crashed process are removed once they are old enough
+  auto const stale = cache_dir / "StaleProg.tmp.1.1";
+  auto const fresh = cache_dir / "FreshProg.tmp.1.1";
+  for (auto const& path : {stale, fresh}) {
+    std::ofstream file(path.string());
+    file << "partial";
+  }
+  boost::filesystem::last_write_time(stale, std::time(nullptr) - 24 * 60 * 60);
+
+  setenv("LIBCUDF_KERNEL_CACHE_LIMIT", "1", 1);
+  cudf::jit::cudfJitCache cache;
+  auto program = cache.getProgram("FileCacheStaleTempFileTestProg", program_source);
+  unsetenv("LIBCUDF_KERNEL_CACHE_LIMIT");
+
+  EXPECT_FALSE(boost::filesystem::exists(stale));
+  EXPECT_TRUE(boost::filesystem::exists(fresh));
+  boost::filesystem::remove(fresh);
+}
 #endif
 
 }  // namespace test
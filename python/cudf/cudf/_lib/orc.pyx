@@ -108,6 +108,10 @@ cpdef write_orc(Table table,
         compression_ = compression_type.NONE
     elif compression == "snappy":
         compression_ = compression_type.SNAPPY
+    elif compression == "zstd":
+        compression_ = compression_type.ZSTD
+    elif compression == "lz4":
+        compression_ = compression_type.LZ4
     else:
         raise ValueError(
             "Unsupported compression type `{}`".format(compression)